@@ -0,0 +1,92 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <kstd/platform/bulk_copy.hpp>
+#include <kstd/platform/virtual_arena.hpp>
+#include <vector>
+
+static constexpr kstd::usize max_size = 256 * 1024 * 1024;
+
+// Every iteration copies into a different part of the arena, like a bulk load into a fresh mapping
+static auto get_destination(kstd::usize size, kstd::usize iteration) -> kstd::u8* {
+    static kstd::platform::mm::VirtualArena s_arena {max_size};
+    static auto* s_data = static_cast<kstd::u8*>(s_arena.allocate(max_size).get_or_throw());
+    return s_data + (iteration * size) % (max_size - size + 1);// NOLINT
+}
+
+static void bench_memcpy(benchmark::State& state) {
+    const auto size = static_cast<kstd::usize>(state.range(0));
+    std::vector<kstd::u8> source(size, 0x42);
+    kstd::usize iteration = 0;
+
+    for(auto _ : state) {
+        auto* destination = get_destination(size, iteration++);
+        std::memcpy(destination, source.data(), size);
+        benchmark::DoNotOptimize(destination);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+static void bench_bulk_copy(benchmark::State& state) {
+    const auto size = static_cast<kstd::usize>(state.range(0));
+    std::vector<kstd::u8> source(size, 0x42);
+    kstd::usize iteration = 0;
+
+    for(auto _ : state) {
+        auto* destination = get_destination(size, iteration++);
+        kstd::platform::mm::bulk_copy(destination, source.data(), size);
+        benchmark::DoNotOptimize(destination);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+static void bench_memset(benchmark::State& state) {
+    const auto size = static_cast<kstd::usize>(state.range(0));
+    kstd::usize iteration = 0;
+
+    for(auto _ : state) {
+        auto* destination = get_destination(size, iteration++);
+        std::memset(destination, 0x42, size);
+        benchmark::DoNotOptimize(destination);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+static void bench_bulk_fill(benchmark::State& state) {
+    const auto size = static_cast<kstd::usize>(state.range(0));
+    kstd::usize iteration = 0;
+
+    for(auto _ : state) {
+        auto* destination = get_destination(size, iteration++);
+        kstd::platform::mm::bulk_fill(destination, 0x42, size);
+        benchmark::DoNotOptimize(destination);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+BENCHMARK(bench_memcpy)->RangeMultiplier(8)->Range(64 * 1024, 64 * 1024 * 1024);
+BENCHMARK(bench_bulk_copy)->RangeMultiplier(8)->Range(64 * 1024, 64 * 1024 * 1024);
+BENCHMARK(bench_memset)->RangeMultiplier(8)->Range(64 * 1024, 64 * 1024 * 1024);
+BENCHMARK(bench_bulk_fill)->RangeMultiplier(8)->Range(64 * 1024, 64 * 1024 * 1024);
@@ -0,0 +1,66 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <kstd/platform/slab_allocator.hpp>
+#include <vector>
+
+static constexpr kstd::usize object_size = 128;
+static constexpr kstd::usize batch_size = 1024;
+
+static void bench_slab_allocator(benchmark::State& state) {
+    static kstd::platform::mm::SlabAllocator s_allocator {object_size};
+    std::vector<void*> objects(batch_size);
+
+    for(auto _ : state) {
+        for(auto& object : objects) {
+            object = *s_allocator.allocate();
+        }
+
+        benchmark::DoNotOptimize(objects.data());
+
+        for(auto* object : objects) {
+            s_allocator.deallocate(object);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch_size));
+}
+
+static void bench_malloc(benchmark::State& state) {
+    std::vector<void*> objects(batch_size);
+
+    for(auto _ : state) {
+        for(auto& object : objects) {
+            object = std::malloc(object_size);// NOLINT
+        }
+
+        benchmark::DoNotOptimize(objects.data());
+
+        for(auto* object : objects) {
+            std::free(object);// NOLINT
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch_size));
+}
+
+BENCHMARK(bench_slab_allocator)->ThreadRange(1, 8);
+BENCHMARK(bench_malloc)->ThreadRange(1, 8);
@@ -0,0 +1,82 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "kstd/platform/dns.hpp"
+#include "kstd/platform/dns_message.hpp"
+#include <chrono>
+#include <functional>
+#include <future>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace kstd::platform {
+    /**
+     * Receives the outcome of an asynchronous lookup. Called on the event thread
+     * of the resolver, so it must neither block nor throw.
+     */
+    using DnsCallback = std::function<void(Result<DnsAnswer>)>;
+
+    struct AsyncResolverStatistics final {
+        usize query_count;
+        usize retry_count;
+        usize timeout_count;
+        usize truncated_count;
+        usize pending_count;
+    };
+
+    struct AsyncResolverState;
+
+    /**
+     * Resolves many names concurrently from a single event thread. Queries are sent over one
+     * non-blocking UDP socket and matched to their responses by ID and question, so thousands
+     * of them can be outstanding at once. Unanswered queries are retried on the next nameserver
+     * once they time out, truncated responses are fetched again over TCP. Nameservers may carry
+     * a port like 127.0.0.1:5353, without any the ones of the system are used.
+     * This is only available on Linux, as it is built on epoll.
+     */
+    class AsyncResolver final {
+        std::unique_ptr<AsyncResolverState> _state;
+
+        public:
+        static constexpr std::chrono::milliseconds default_timeout {1000};
+        static constexpr usize default_attempt_count = 3;
+
+        explicit AsyncResolver(std::vector<std::string> dns_addresses = {},
+                               std::chrono::milliseconds timeout = default_timeout,
+                               usize attempt_count = default_attempt_count);
+        AsyncResolver(AsyncResolver&& other) noexcept;
+        ~AsyncResolver() noexcept;
+
+        auto operator=(AsyncResolver&& other) noexcept -> AsyncResolver&;
+
+        KSTD_NO_COPY(AsyncResolver, AsyncResolver)
+
+        auto resolve(const std::string& address, RecordType type, DnsCallback callback) -> void;
+
+        [[nodiscard]] auto resolve(const std::string& address, RecordType type) -> std::future<Result<DnsAnswer>>;
+
+        [[nodiscard]] auto get_statistics() const noexcept -> AsyncResolverStatistics;
+    };
+}// namespace kstd::platform
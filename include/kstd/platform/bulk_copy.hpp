@@ -0,0 +1,334 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "memory_mapping.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define KSTD_STREAMING_X86
+#endif
+
+#ifdef KSTD_STREAMING_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define KSTD_STREAMING_TARGET(x)
+#else
+#define KSTD_STREAMING_TARGET(x) __attribute__((target(x)))
+#endif
+#endif
+
+namespace kstd::platform::mm {
+    enum class StreamingIsa : u8 {
+        NONE,
+        SSE2,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * Transfers of at least this many bytes bypass the cache, below it
+     * the destination is likely to be read again soon enough to keep it cached.
+     */
+    inline constexpr usize streaming_threshold = 256 * 1024;
+
+    /**
+     * Returns the widest instruction set with non-temporal stores which is
+     * supported by both the CPU and the operating system. It is detected once.
+     */
+    [[nodiscard]] inline auto get_streaming_isa() noexcept -> StreamingIsa {
+#ifdef KSTD_STREAMING_X86
+        static const auto s_isa = []() noexcept -> StreamingIsa {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4] {};// NOLINT
+            __cpuid(info, 1);
+            const auto has_avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0;// OSXSAVE and AVX
+            const auto state = has_avx ? _xgetbv(0) : 0;
+            __cpuidex(info, 7, 0);
+
+            if((state & 0xE6U) == 0xE6U && (info[1] & (1 << 16)) != 0) {
+                return StreamingIsa::AVX512;
+            }
+
+            if((state & 0x06U) == 0x06U && (info[1] & (1 << 5)) != 0) {
+                return StreamingIsa::AVX2;
+            }
+
+            return StreamingIsa::SSE2;
+#else
+            __builtin_cpu_init();
+
+            if(__builtin_cpu_supports("avx512f")) {
+                return StreamingIsa::AVX512;
+            }
+
+            if(__builtin_cpu_supports("avx2")) {
+                return StreamingIsa::AVX2;
+            }
+
+            return __builtin_cpu_supports("sse2") ? StreamingIsa::SSE2 : StreamingIsa::NONE;
+#endif
+        }();
+        return s_isa;
+#else
+        return StreamingIsa::NONE;
+#endif
+    }
+
+    // Returns how many bytes lie in front of the first address aligned to the given width
+    [[nodiscard]] inline auto get_streaming_head(const void* address, usize width, usize size) noexcept -> usize {
+        const auto misalignment = reinterpret_cast<uintptr_t>(address) & (width - 1);// NOLINT
+        return std::min(size, misalignment == 0 ? 0 : width - misalignment);
+    }
+
+#ifdef KSTD_STREAMING_X86
+    KSTD_STREAMING_TARGET("sse2")
+    inline auto stream_copy_sse2(u8* destination, const u8* source, usize size) noexcept -> void {
+        constexpr usize width = sizeof(__m128i);
+        const auto head = get_streaming_head(destination, width, size);
+        std::memcpy(destination, source, head);
+        destination += head;// NOLINT
+        source += head;     // NOLINT
+        size -= head;
+
+        for(; size >= width * 4; size -= width * 4, destination += width * 4, source += width * 4) {// NOLINT
+            const auto* from = reinterpret_cast<const __m128i*>(source);// NOLINT
+            auto* to = reinterpret_cast<__m128i*>(destination);         // NOLINT
+            const auto first = _mm_loadu_si128(from);
+            const auto second = _mm_loadu_si128(from + 1);// NOLINT
+            const auto third = _mm_loadu_si128(from + 2); // NOLINT
+            const auto fourth = _mm_loadu_si128(from + 3);// NOLINT
+            _mm_stream_si128(to, first);
+            _mm_stream_si128(to + 1, second);// NOLINT
+            _mm_stream_si128(to + 2, third); // NOLINT
+            _mm_stream_si128(to + 3, fourth);// NOLINT
+        }
+
+        for(; size >= width; size -= width, destination += width, source += width) {// NOLINT
+            _mm_stream_si128(reinterpret_cast<__m128i*>(destination),               // NOLINT
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));// NOLINT
+        }
+
+        _mm_sfence();// Streaming stores are weakly ordered, so publish them before returning
+        std::memcpy(destination, source, size);
+    }
+
+    KSTD_STREAMING_TARGET("avx2")
+    inline auto stream_copy_avx2(u8* destination, const u8* source, usize size) noexcept -> void {
+        constexpr usize width = sizeof(__m256i);
+        const auto head = get_streaming_head(destination, width, size);
+        std::memcpy(destination, source, head);
+        destination += head;// NOLINT
+        source += head;     // NOLINT
+        size -= head;
+
+        for(; size >= width * 4; size -= width * 4, destination += width * 4, source += width * 4) {// NOLINT
+            const auto* from = reinterpret_cast<const __m256i*>(source);// NOLINT
+            auto* to = reinterpret_cast<__m256i*>(destination);         // NOLINT
+            const auto first = _mm256_loadu_si256(from);
+            const auto second = _mm256_loadu_si256(from + 1);// NOLINT
+            const auto third = _mm256_loadu_si256(from + 2); // NOLINT
+            const auto fourth = _mm256_loadu_si256(from + 3);// NOLINT
+            _mm256_stream_si256(to, first);
+            _mm256_stream_si256(to + 1, second);// NOLINT
+            _mm256_stream_si256(to + 2, third); // NOLINT
+            _mm256_stream_si256(to + 3, fourth);// NOLINT
+        }
+
+        for(; size >= width; size -= width, destination += width, source += width) {// NOLINT
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(destination),                  // NOLINT
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)));// NOLINT
+        }
+
+        _mm_sfence();
+        std::memcpy(destination, source, size);
+    }
+
+    KSTD_STREAMING_TARGET("avx512f")
+    inline auto stream_copy_avx512(u8* destination, const u8* source, usize size) noexcept -> void {
+        constexpr usize width = sizeof(__m512i);
+        const auto head = get_streaming_head(destination, width, size);
+        std::memcpy(destination, source, head);
+        destination += head;// NOLINT
+        source += head;     // NOLINT
+        size -= head;
+
+        for(; size >= width * 4; size -= width * 4, destination += width * 4, source += width * 4) {// NOLINT
+            auto* to = reinterpret_cast<__m512i*>(destination);// NOLINT
+            const auto first = _mm512_loadu_si512(source);
+            const auto second = _mm512_loadu_si512(source + width);    // NOLINT
+            const auto third = _mm512_loadu_si512(source + width * 2); // NOLINT
+            const auto fourth = _mm512_loadu_si512(source + width * 3);// NOLINT
+            _mm512_stream_si512(to, first);
+            _mm512_stream_si512(to + 1, second);// NOLINT
+            _mm512_stream_si512(to + 2, third); // NOLINT
+            _mm512_stream_si512(to + 3, fourth);// NOLINT
+        }
+
+        for(; size >= width; size -= width, destination += width, source += width) {// NOLINT
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(destination), _mm512_loadu_si512(source));// NOLINT
+        }
+
+        _mm_sfence();
+        std::memcpy(destination, source, size);
+    }
+
+    KSTD_STREAMING_TARGET("sse2")
+    inline auto stream_fill_sse2(u8* destination, u8 value, usize size) noexcept -> void {
+        constexpr usize width = sizeof(__m128i);
+        const auto head = get_streaming_head(destination, width, size);
+        const auto pattern = _mm_set1_epi8(static_cast<char>(value));
+        std::memset(destination, value, head);
+        destination += head;// NOLINT
+        size -= head;
+
+        for(; size >= width; size -= width, destination += width) {// NOLINT
+            _mm_stream_si128(reinterpret_cast<__m128i*>(destination), pattern);// NOLINT
+        }
+
+        _mm_sfence();
+        std::memset(destination, value, size);
+    }
+
+    KSTD_STREAMING_TARGET("avx2")
+    inline auto stream_fill_avx2(u8* destination, u8 value, usize size) noexcept -> void {
+        constexpr usize width = sizeof(__m256i);
+        const auto head = get_streaming_head(destination, width, size);
+        const auto pattern = _mm256_set1_epi8(static_cast<char>(value));
+        std::memset(destination, value, head);
+        destination += head;// NOLINT
+        size -= head;
+
+        for(; size >= width; size -= width, destination += width) {// NOLINT
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(destination), pattern);// NOLINT
+        }
+
+        _mm_sfence();
+        std::memset(destination, value, size);
+    }
+
+    KSTD_STREAMING_TARGET("avx512f")
+    inline auto stream_fill_avx512(u8* destination, u8 value, usize size) noexcept -> void {
+        constexpr usize width = sizeof(__m512i);
+        const auto head = get_streaming_head(destination, width, size);
+        const auto pattern = _mm512_set1_epi32(static_cast<i32>(value * 0x01010101U));// Byte splats need AVX-512BW
+        std::memset(destination, value, head);
+        destination += head;// NOLINT
+        size -= head;
+
+        for(; size >= width; size -= width, destination += width) {// NOLINT
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(destination), pattern);// NOLINT
+        }
+
+        _mm_sfence();
+        std::memset(destination, value, size);
+    }
+#endif
+
+    /**
+     * Copies with non-temporal stores of the given instruction set, which is lowered
+     * to what the CPU supports. Falls back to std::memcpy where there is none.
+     */
+    inline auto stream_copy(void* destination, const void* source, usize size,
+                            StreamingIsa isa = get_streaming_isa()) noexcept -> void {
+        auto* to = static_cast<u8*>(destination);
+        const auto* from = static_cast<const u8*>(source);
+
+        switch(std::min(isa, get_streaming_isa())) {
+#ifdef KSTD_STREAMING_X86
+            case StreamingIsa::AVX512: stream_copy_avx512(to, from, size); break;
+            case StreamingIsa::AVX2: stream_copy_avx2(to, from, size); break;
+            case StreamingIsa::SSE2: stream_copy_sse2(to, from, size); break;
+#endif
+            default: std::memcpy(to, from, size); break;
+        }
+    }
+
+    inline auto stream_fill(void* destination, u8 value, usize size,
+                            StreamingIsa isa = get_streaming_isa()) noexcept -> void {
+        auto* to = static_cast<u8*>(destination);
+
+        switch(std::min(isa, get_streaming_isa())) {
+#ifdef KSTD_STREAMING_X86
+            case StreamingIsa::AVX512: stream_fill_avx512(to, value, size); break;
+            case StreamingIsa::AVX2: stream_fill_avx2(to, value, size); break;
+            case StreamingIsa::SSE2: stream_fill_sse2(to, value, size); break;
+#endif
+            default: std::memset(to, value, size); break;
+        }
+    }
+
+    /**
+     * Copies through the cache below the streaming threshold and around it above,
+     * so bulk loads don't evict the working set of the rest of the process.
+     */
+    inline auto bulk_copy(void* destination, const void* source, usize size) noexcept -> void {
+        if(size < streaming_threshold) {
+            std::memcpy(destination, source, size);
+            return;
+        }
+
+        stream_copy(destination, source, size);
+    }
+
+    inline auto bulk_fill(void* destination, u8 value, usize size) noexcept -> void {
+        if(size < streaming_threshold) {
+            std::memset(destination, value, size);
+            return;
+        }
+
+        stream_fill(destination, value, size);
+    }
+
+    [[nodiscard]] inline auto bulk_copy(MemoryMapping& mapping, usize offset, const void* source, usize size) noexcept
+            -> Result<void> {
+        if(!MappingRange {offset, size}.is_within(mapping.get_size())) {
+            return Error {fmt::format("Could not copy into mapping: range {}..{} exceeds mapping size {}", offset,
+                                      offset + size, mapping.get_size())};
+        }
+
+        if((mapping.get_access() & MappingAccess::WRITE) != MappingAccess::WRITE) {
+            return Error {std::string("Could not copy into mapping: mapping is not writable")};
+        }
+
+        bulk_copy(static_cast<u8*>(mapping.get_address()) + offset, source, size);// NOLINT
+        return {};
+    }
+
+    [[nodiscard]] inline auto bulk_fill(MemoryMapping& mapping, MappingRange range, u8 value) noexcept
+            -> Result<void> {
+        if(!range.is_within(mapping.get_size())) {
+            return Error {fmt::format("Could not fill mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), mapping.get_size())};
+        }
+
+        if((mapping.get_access() & MappingAccess::WRITE) != MappingAccess::WRITE) {
+            return Error {std::string("Could not fill mapping: mapping is not writable")};
+        }
+
+        bulk_fill(static_cast<u8*>(mapping.get_address()) + range.offset, value, range.size);// NOLINT
+        return {};
+    }
+}// namespace kstd::platform::mm
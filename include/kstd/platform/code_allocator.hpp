@@ -0,0 +1,295 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "memory_mapping.hpp"
+#include <algorithm>
+#include <array>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <new>
+#include <vector>
+
+namespace kstd::platform::mm {
+    struct CodeBlock final {
+        u8* writable;
+        const u8* executable;
+        usize size;
+
+        [[nodiscard]] constexpr auto is_valid() const noexcept -> bool {
+            return executable != nullptr;
+        }
+
+        template<typename F>
+        [[nodiscard]] inline auto get_function() const noexcept -> F* {
+            return reinterpret_cast<F*>(executable);// NOLINT
+        }
+    };
+
+    struct CodeChunk final {
+        u8* writable;
+        u8* executable;
+        usize size;
+        usize used;
+        usize flushed;
+        usize reused_begin;// Range of reused blocks which still needs flushing, empty if begin >= end
+        usize reused_end;
+
+        // Reused blocks past the flushed offset are flushed along with the rest of the chunk anyway
+        [[nodiscard]] constexpr auto get_reused_size() const noexcept -> usize {
+            const auto end = std::min(reused_end, flushed);
+            return reused_begin < end ? end - reused_begin : 0;
+        }
+    };
+
+    /**
+     * A bump allocator for generated machine code which never maps memory as
+     * writable and executable at once. Each chunk of shared memory is mapped twice,
+     * code is emitted through the writable view and run from the executable view
+     * once finalize() flushed the instruction cache for everything emitted since.
+     * Freed blocks are kept in free lists by power-of-two size class and handed
+     * out again before the chunks grow any further.
+     * Not thread-safe, every emitting thread should own its allocator.
+     */
+    class CodeAllocator final {
+        static constexpr usize size_class_count = sizeof(usize) * 8;
+
+        std::vector<CodeChunk> _chunks;
+        std::array<std::vector<CodeBlock>, size_class_count> _free_blocks;
+        usize _free_size;
+        usize _chunk_size;
+
+        [[nodiscard]] static auto map_chunk(usize size) noexcept -> Result<CodeChunk>;
+
+        static auto unmap_chunk(const CodeChunk& chunk) noexcept -> void;
+
+        [[nodiscard]] static auto flush_instruction_cache(const void* address, usize size) noexcept -> Result<void>;
+
+        // Every block in a size class is at least 2^class bytes large
+        [[nodiscard]] static constexpr auto get_size_class(usize size) noexcept -> usize {
+            usize size_class = 0;
+
+            while(size > 1) {
+                size >>= 1U;
+                ++size_class;
+            }
+
+            return size_class;
+        }
+
+        [[nodiscard]] inline auto reuse_block(usize size, usize alignment) noexcept -> CodeBlock {
+            auto& blocks = _free_blocks[get_size_class(size)];
+
+            for(auto iterator = blocks.begin(); iterator != blocks.end(); ++iterator) {
+                const auto block = *iterator;
+
+                if(block.size < size || reinterpret_cast<usize>(block.executable) % alignment != 0) {// NOLINT
+                    continue;
+                }
+
+                blocks.erase(iterator);
+                _free_size -= block.size;
+
+                for(auto& chunk : _chunks) {
+                    if(block.executable < chunk.executable || block.executable >= chunk.executable + chunk.size) {
+                        continue;
+                    }
+
+                    const auto offset = static_cast<usize>(block.executable - chunk.executable);
+                    const auto is_empty = chunk.reused_begin >= chunk.reused_end;
+                    chunk.reused_begin = is_empty ? offset : std::min(chunk.reused_begin, offset);
+                    chunk.reused_end = is_empty ? offset + block.size : std::max(chunk.reused_end, offset + block.size);
+                    break;
+                }
+
+                return block;
+            }
+
+            return {};
+        }
+
+        public:
+        static constexpr usize default_chunk_size = 1U << 20U;
+        static constexpr usize default_alignment = 16;
+
+        CodeAllocator(CodeAllocator&& other) noexcept;
+
+        explicit CodeAllocator(usize chunk_size = default_chunk_size) noexcept;
+
+        ~CodeAllocator() noexcept;
+
+        auto operator=(CodeAllocator&& other) noexcept -> CodeAllocator&;
+
+        KSTD_NO_COPY(CodeAllocator, CodeAllocator)
+
+        /**
+         * Returns a block of at least size bytes whose executable address is aligned to the
+         * given power of two. The block may only be executed after the next call to finalize().
+         */
+        [[nodiscard]] inline auto allocate(usize size, usize alignment = default_alignment) noexcept
+                -> Result<CodeBlock> {
+            // Chunks are page aligned, so offsets within them satisfy any alignment up to the page size
+            const auto page_size = get_page_size();
+            const auto is_power_of_two = alignment != 0 && (alignment & (alignment - 1)) == 0;
+
+            if(size == 0 || !is_power_of_two || alignment > page_size) {
+                return Error {fmt::format("Could not allocate code block of {} bytes aligned to {}", size, alignment)};
+            }
+
+            if(const auto block = reuse_block(size, alignment); block.is_valid()) {
+                return block;
+            }
+
+            if(!_chunks.empty()) {
+                auto& chunk = _chunks.back();
+                const auto offset = (chunk.used + alignment - 1) & ~(alignment - 1);
+
+                if(offset <= chunk.size && size <= chunk.size - offset) {
+                    chunk.used = offset + size;
+                    return CodeBlock {chunk.writable + offset, chunk.executable + offset, size};// NOLINT
+                }
+            }
+
+            const auto chunk_size = MappingRange {0, std::max(_chunk_size, size)}.align_to(page_size).size;
+            auto chunk = map_chunk(chunk_size);
+
+            if(!chunk) {
+                return chunk.forward<CodeBlock>();
+            }
+
+            chunk->used = size;
+            _chunks.push_back(*chunk);
+            return CodeBlock {chunk->writable, chunk->executable, size};
+        }
+
+        /**
+         * Returns a block to the allocator, so its memory can be handed out again.
+         * The block must not be running anymore. A block which does not fit into
+         * its free list when memory runs out stays unused until the next reset().
+         */
+        inline auto deallocate(const CodeBlock& block) noexcept -> void {
+            if(!block.is_valid()) {
+                return;
+            }
+
+            try {
+                _free_blocks[get_size_class(block.size)].push_back(block);
+                _free_size += block.size;
+            }
+            catch(const std::bad_alloc&) {
+                // Leaking the block until reset() is the only safe option here
+            }
+        }
+
+        /**
+         * Makes all blocks allocated since the last call executable by flushing the
+         * instruction cache for them, one call per chunk rather than one per block.
+         */
+        [[nodiscard]] inline auto finalize() noexcept -> Result<void> {
+            for(auto& chunk : _chunks) {
+                if(const auto reused_size = chunk.get_reused_size(); reused_size != 0) {
+                    auto result = flush_instruction_cache(chunk.executable + chunk.reused_begin, reused_size);
+
+                    if(!result) {
+                        return result;
+                    }
+
+                }
+
+                chunk.reused_begin = chunk.reused_end = 0;
+
+                if(chunk.flushed == chunk.used) {
+                    continue;
+                }
+
+                auto result = flush_instruction_cache(chunk.executable + chunk.flushed, chunk.used - chunk.flushed);
+
+                if(!result) {
+                    return result;
+                }
+
+                chunk.flushed = chunk.used;
+            }
+
+            return {};
+        }
+
+        /**
+         * Releases all chunks but the first one and rewinds it, which invalidates
+         * every block allocated so far. None of them may be running anymore.
+         */
+        inline auto reset() noexcept -> void {
+            if(_chunks.empty()) {
+                return;
+            }
+
+            std::for_each(_chunks.cbegin() + 1, _chunks.cend(), unmap_chunk);
+            _chunks.resize(1);
+            _chunks.front().used = 0;
+            _chunks.front().flushed = 0;
+            _chunks.front().reused_begin = _chunks.front().reused_end = 0;
+
+            for(auto& blocks : _free_blocks) {
+                blocks.clear();
+            }
+
+            _free_size = 0;
+        }
+
+        [[nodiscard]] inline auto get_used_size() const noexcept -> usize {
+            usize size = 0;
+
+            for(const auto& chunk : _chunks) {
+                size += chunk.used;
+            }
+
+            return size - _free_size;
+        }
+
+        [[nodiscard]] inline auto get_pending_size() const noexcept -> usize {
+            usize size = 0;
+
+            for(const auto& chunk : _chunks) {
+                size += chunk.used - chunk.flushed + chunk.get_reused_size();
+            }
+
+            return size;
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            usize size = 0;
+
+            for(const auto& chunk : _chunks) {
+                size += chunk.size;
+            }
+
+            return size;
+        }
+
+        [[nodiscard]] inline auto get_chunk_size() const noexcept -> usize {
+            return _chunk_size;
+        }
+
+        [[nodiscard]] inline auto get_chunks() const noexcept -> const std::vector<CodeChunk>& {
+            return _chunks;
+        }
+    };
+}// namespace kstd::platform::mm
@@ -0,0 +1,173 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "memory_mapping.hpp"
+#include <atomic>
+#include <bitset>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <vector>
+
+namespace kstd::platform::mm {
+    /**
+     * A page-granular bitmap of modified pages. Marking is lock-free and
+     * async-signal-safe, so it may be used from fault handlers.
+     */
+    class DirtyPageMap final {
+        static constexpr usize bits_per_word = sizeof(u64) << 3;
+
+        std::unique_ptr<std::atomic<u64>[]> _words;// NOLINT
+        usize _size;
+        usize _page_size;
+        usize _page_count;
+
+        template<bool CLEAR>
+        [[nodiscard]] inline auto collect_ranges() noexcept -> std::vector<MappingRange> {
+            std::vector<MappingRange> ranges {};
+            const auto word_count = get_word_count();
+            usize run_begin = 0;
+            bool is_in_run = false;
+
+            for(usize word_index = 0; word_index < word_count; ++word_index) {
+                const auto word = CLEAR ? _words[word_index].exchange(0, std::memory_order_acq_rel)
+                                        : _words[word_index].load(std::memory_order_acquire);
+
+                if(!is_in_run && word == 0) {
+                    continue;
+                }
+
+                for(usize bit = 0; bit < bits_per_word; ++bit) {
+                    const auto page = word_index * bits_per_word + bit;
+                    const auto is_dirty = ((word >> bit) & 1U) != 0;
+
+                    if(is_dirty && !is_in_run) {
+                        run_begin = page;
+                        is_in_run = true;
+                    }
+                    else if(!is_dirty && is_in_run) {
+                        ranges.push_back(to_range(run_begin, page));
+                        is_in_run = false;
+                    }
+                }
+            }
+
+            if(is_in_run) {
+                ranges.push_back(to_range(run_begin, _page_count));
+            }
+
+            return ranges;
+        }
+
+        [[nodiscard]] inline auto to_range(usize first_page, usize end_page) const noexcept -> MappingRange {
+            const auto begin = first_page * _page_size;
+            const auto end = std::min(end_page * _page_size, _size);
+            return {begin, end - begin};
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE(DirtyPageMap, DirtyPageMap)
+        KSTD_NO_COPY(DirtyPageMap, DirtyPageMap)
+
+        DirtyPageMap() noexcept :
+                _size {0},
+                _page_size {0},
+                _page_count {0} {
+        }
+
+        explicit DirtyPageMap(usize size, usize page_size = platform::get_page_size()) :
+                _size {size},
+                _page_size {page_size},
+                _page_count {(size + page_size - 1) / page_size} {
+            _words = std::make_unique<std::atomic<u64>[]>(get_word_count());// NOLINT
+        }
+
+        ~DirtyPageMap() noexcept = default;
+
+        inline auto mark_page(usize page) noexcept -> void {
+            _words[page / bits_per_word].fetch_or(u64 {1} << (page % bits_per_word), std::memory_order_release);
+        }
+
+        inline auto mark(MappingRange range) noexcept -> void {
+            if(range.size == 0 || !range.is_within(_size)) {
+                return;
+            }
+
+            const auto last_page = (range.get_end() - 1) / _page_size;
+
+            for(auto page = range.offset / _page_size; page <= last_page; ++page) {
+                mark_page(page);
+            }
+        }
+
+        [[nodiscard]] inline auto is_dirty(usize page) const noexcept -> bool {
+            const auto word = _words[page / bits_per_word].load(std::memory_order_acquire);
+            return ((word >> (page % bits_per_word)) & 1U) != 0;
+        }
+
+        [[nodiscard]] inline auto get_dirty_page_count() const noexcept -> usize {
+            const auto word_count = get_word_count();
+            usize count = 0;
+
+            for(usize index = 0; index < word_count; ++index) {
+                count += std::bitset<bits_per_word>(_words[index].load(std::memory_order_relaxed)).count();
+            }
+
+            return count;
+        }
+
+        /**
+         * Returns the dirty pages as a list of coalesced ranges clamped
+         * to the tracked size, without clearing them.
+         */
+        [[nodiscard]] inline auto get_ranges() noexcept -> std::vector<MappingRange> {
+            return collect_ranges<false>();
+        }
+
+        /**
+         * Returns the dirty pages as a list of coalesced ranges clamped
+         * to the tracked size and atomically clears them.
+         */
+        [[nodiscard]] inline auto take_ranges() noexcept -> std::vector<MappingRange> {
+            return collect_ranges<true>();
+        }
+
+        [[nodiscard]] inline auto get_data() noexcept -> std::atomic<u64>* {
+            return _words.get();
+        }
+
+        [[nodiscard]] inline auto get_word_count() const noexcept -> usize {
+            return (_page_count + bits_per_word - 1) / bits_per_word;
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto get_page_size() const noexcept -> usize {
+            return _page_size;
+        }
+
+        [[nodiscard]] inline auto get_page_count() const noexcept -> usize {
+            return _page_count;
+        }
+    };
+}// namespace kstd::platform::mm
@@ -19,11 +19,17 @@
 
 #pragma once
 
+#include "kstd/platform/dns_cache.hpp"
+#include "kstd/platform/dns_message.hpp"
 #include "kstd/platform/platform.hpp"
+#include <algorithm>
+#include <chrono>
 #include <fmt/format.h>
 #include <initializer_list>
 #include <kstd/bitflags.hpp>
 #include <kstd/result.hpp>
+#include <memory>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -64,21 +70,107 @@ namespace kstd::platform {
     };
 #endif
 
+#ifndef PLATFORM_WINDOWS
+    struct ResolverStateDeleter final {
+        inline auto operator()(struct __res_state* state) const noexcept -> void {
+            ::res_nclose(state);
+            delete state;// NOLINT
+        }
+    };
+#endif
+
+    /**
+     * Resolves names through the configured nameservers, which may carry a port like 127.0.0.1:5353
+     * except on Windows, or through the ones of the system. Every resolver has its own state,
+     * so threads can resolve concurrently through their own resolvers, but a single resolver
+     * is only meant to be used by one thread at a time. Per-thread resolvers can share one
+     * cache through set_cache, as caches are thread-safe.
+     */
     class Resolver final {
 #ifdef PLATFORM_WINDOWS
         kstd::Option<IP4Array> _dns_addresses;
 #else
-        std::vector<std::string> _dns_addresses;
+        std::unique_ptr<struct __res_state, ResolverStateDeleter> _state;
 #endif
+        std::shared_ptr<DnsCache<DnsAnswer>> _cache;
+
+        // Cached answers only live for as long as their entry has left, so their TTLs are aged accordingly
+        [[nodiscard]] inline auto find_cached(const std::string& address, RecordType type) const
+                -> std::optional<Result<DnsAnswer>> {
+            auto hit = _cache != nullptr ? _cache->find(address, static_cast<u16>(type)) : std::nullopt;
+
+            if(!hit) {
+                return std::nullopt;
+            }
+
+            if(auto& answer = hit->result; answer) {
+                const auto age = static_cast<u32>(hit->age.count());
+                answer->ttl = static_cast<u32>(hit->remaining_ttl.count());
+
+                for(auto& record : answer->addresses) {
+                    record.ttl = std::min(record.ttl > age ? record.ttl - age : 0, answer->ttl);
+                }
+            }
+
+            return std::move(hit->result);
+        }
 
         public:
+        static constexpr usize default_window_size = 128;
+
         Resolver(std::vector<std::string> dns_addresses);
         Resolver();
         ~Resolver();
         KSTD_DEFAULT_MOVE(Resolver, Resolver)
         KSTD_NO_COPY(Resolver, Resolver)
 
-        [[nodiscard]] auto resolve(const std::string& address, RecordType type) noexcept -> kstd::Result<std::string>;
+        /**
+         * Resolves the addresses of the given type, following aliases. Returns an error
+         * if the name does not exist or has no such address.
+         */
+        [[nodiscard]] auto resolve(const std::string& address, RecordType type) noexcept -> kstd::Result<DnsAnswer>;
+
+        /**
+         * Resolves every address for every type, keeping up to the given number of queries in flight
+         * across the nameservers at once. The result for the i-th address and j-th type is found at
+         * index i * types.size() + j. On Linux, queries are sent and received in batches over one
+         * socket, everywhere else this falls back to resolving one after another.
+         */
+        [[nodiscard]] auto resolve_many(const std::vector<std::string>& addresses, const std::vector<RecordType>& types,
+                                        usize window_size = default_window_size)
+                -> std::vector<kstd::Result<DnsAnswer>>;
+
+        /**
+         * Sets how long to wait for a response before asking the next nameserver, and how
+         * often to ask in total. Windows decides on its own, so this has no effect there.
+         */
+        auto set_timeout(std::chrono::seconds timeout, usize attempt_count) noexcept -> void;
+
+        /**
+         * Caches up to the given number of responses for as long as their TTL allows,
+         * or disables caching with a capacity of zero. Replacing the cache empties it.
+         * Like set_cache, this must not be called while the resolver is resolving.
+         */
+        inline auto set_cache_capacity(usize capacity, usize shard_count = DnsCache<DnsAnswer>::default_shard_count)
+                -> void {
+            _cache = capacity == 0 ? nullptr : std::make_shared<DnsCache<DnsAnswer>>(capacity, shard_count);
+        }
+
+        /**
+         * Replaces the cache of this resolver with the given one, which may be shared with
+         * the resolvers of other threads, or disables caching with a null pointer.
+         */
+        inline auto set_cache(std::shared_ptr<DnsCache<DnsAnswer>> cache) noexcept -> void {
+            _cache = std::move(cache);
+        }
+
+        [[nodiscard]] inline auto get_cache() const noexcept -> const std::shared_ptr<DnsCache<DnsAnswer>>& {
+            return _cache;
+        }
+
+        [[nodiscard]] inline auto get_cache_statistics() const -> DnsCacheStatistics {
+            return _cache == nullptr ? DnsCacheStatistics {} : _cache->get_statistics();
+        }
     };
 
     inline auto is_ipv4_address(const std::string& address) noexcept -> bool {
@@ -97,4 +189,38 @@ namespace kstd::platform {
                 ")\\.){3,3}(25[0-5]|(2[0-4]|1{0,1}[0-9]){0,1}[0-9]))");
         return std::regex_match(address, s_pattern);
     }
-}// namespace kstd::platform
\ No newline at end of file
+
+#ifndef PLATFORM_WINDOWS
+    /**
+     * Parses an IPv4 nameserver address with an optional port, like 127.0.0.1:5353,
+     * throwing if it is illegal.
+     */
+    [[nodiscard]] inline auto parse_nameserver_address(const std::string& address) -> sockaddr_in {
+        sockaddr_in nameserver {};
+        nameserver.sin_family = AF_INET;
+        nameserver.sin_port = htons(NAMESERVER_PORT);
+        const auto separator = address.find(':');
+        const auto host = address.substr(0, separator);
+
+        if(separator != std::string::npos) {
+            const auto port = address.substr(separator + 1);
+            const auto is_digit = [](const char value) { return value >= '0' && value <= '9'; };
+            const auto is_numeric = std::all_of(port.cbegin(), port.cend(), is_digit);
+
+            if(port.empty() || port.size() > 5 || !is_numeric || std::stoul(port) == 0 || std::stoul(port) > 0xFFFF) {
+                throw std::runtime_error {fmt::format("Unable to initialize list of DNS servers: Illegal port in {}",
+                                                      address)};
+            }
+
+            nameserver.sin_port = htons(static_cast<u16>(std::stoul(port)));
+        }
+
+        if(!is_ipv4_address(host) || ::inet_pton(AF_INET, host.c_str(), &nameserver.sin_addr) != 1) {
+            throw std::runtime_error {fmt::format("Unable to initialize list of DNS servers: Illegal DNS server {}",
+                                                  address)};
+        }
+
+        return nameserver;
+    }
+#endif
+}// namespace kstd::platform
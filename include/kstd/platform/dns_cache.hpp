@@ -0,0 +1,250 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace kstd::platform {
+    struct DnsCacheStatistics final {
+        usize hit_count;
+        usize negative_hit_count;
+        usize miss_count;
+        usize eviction_count;
+        usize size;
+
+        [[nodiscard]] constexpr auto get_hit_ratio() const noexcept -> f64 {
+            const auto lookup_count = hit_count + miss_count;
+            return lookup_count == 0 ? 0.0 : static_cast<f64>(hit_count) / static_cast<f64>(lookup_count);
+        }
+    };
+
+    template<typename T>
+    struct DnsCacheHit final {
+        Result<T> result;
+        std::chrono::seconds age;          // Time since the entry was inserted
+        std::chrono::seconds remaining_ttl;// Time until the entry expires
+    };
+
+    /**
+     * A concurrent cache of DNS responses keyed by name and record type, which keeps every
+     * entry for as long as its TTL allows. Names are compared case-insensitively, like DNS does. Failed lookups which are known to be authoritative,
+     * like NXDOMAIN, are cached as negative entries. Entries are spread over independently
+     * locked shards, each of which evicts its least recently used entry once it is full.
+     */
+    template<typename T>
+    class DnsCache final {
+        using Clock = std::chrono::steady_clock;
+
+        struct Key final {
+            std::string name;
+            u16 type;
+
+            [[nodiscard]] inline auto operator==(const Key& other) const noexcept -> bool {
+                return type == other.type && name == other.name;
+            }
+        };
+
+        struct KeyHash final {
+            [[nodiscard]] inline auto operator()(const Key& key) const noexcept -> usize {
+                return std::hash<std::string> {}(key.name) ^ (static_cast<usize>(key.type) * 0x9E3779B97F4A7C15ULL);
+            }
+        };
+
+        struct Entry final {
+            Key key;
+            std::optional<T> value;
+            std::string error;
+            Clock::time_point insertion;
+            Clock::time_point expiry;
+        };
+
+        struct Shard final {
+            std::mutex mutex;
+            std::list<Entry> entries;// Most recently used first
+            std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> index;
+        };
+
+        std::unique_ptr<Shard[]> _shards;// NOLINT
+        usize _shard_mask;
+        usize _shard_capacity;
+        std::chrono::seconds _max_ttl;
+        std::atomic<usize> _hit_count;
+        std::atomic<usize> _negative_hit_count;
+        std::atomic<usize> _miss_count;
+        std::atomic<usize> _eviction_count;
+
+        [[nodiscard]] static inline auto make_key(const std::string& name, u16 type) -> Key {
+            Key key {name, type};
+            std::transform(key.name.cbegin(), key.name.cend(), key.name.begin(), [](const char value) {
+                return value >= 'A' && value <= 'Z' ? static_cast<char>(value - 'A' + 'a') : value;
+            });
+            return key;
+        }
+
+        [[nodiscard]] inline auto get_shard(const Key& key) const noexcept -> Shard& {
+            // The low bits feed the map buckets inside of the shard, so pick the shard from the high ones
+            const auto hash = KeyHash {}(key);
+            return _shards[((hash >> (sizeof(usize) * 4)) ^ hash) & _shard_mask];
+        }
+
+        inline auto insert_entry(Key key, std::optional<T> value, std::string error, std::chrono::seconds ttl) -> void {
+            ttl = std::min(ttl, _max_ttl);
+
+            if(ttl.count() <= 0) {
+                return;
+            }
+
+            auto& shard = get_shard(key);
+            const std::lock_guard lock {shard.mutex};
+
+            if(const auto iterator = shard.index.find(key); iterator != shard.index.end()) {
+                shard.entries.erase(iterator->second);
+                shard.index.erase(iterator);
+            }
+            else if(shard.entries.size() >= _shard_capacity) {
+                shard.index.erase(shard.entries.back().key);
+                shard.entries.pop_back();
+                _eviction_count.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            const auto now = Clock::now();
+            shard.entries.push_front({std::move(key), std::move(value), std::move(error), now, now + ttl});
+            shard.index.emplace(shard.entries.front().key, shard.entries.begin());
+        }
+
+        public:
+        static constexpr usize default_capacity = 4096;
+        static constexpr usize default_shard_count = 16;
+        static constexpr std::chrono::seconds default_max_ttl {86400};
+
+        KSTD_NO_COPY(DnsCache, DnsCache)
+
+        /**
+         * Creates a cache of at most capacity entries. The shard count is rounded up to a power
+         * of two, and TTLs longer than max_ttl are shortened to it.
+         */
+        explicit DnsCache(usize capacity = default_capacity, usize shard_count = default_shard_count,
+                          std::chrono::seconds max_ttl = default_max_ttl) :
+                _shard_mask {0},
+                _shard_capacity {0},
+                _max_ttl {max_ttl},
+                _hit_count {0},
+                _negative_hit_count {0},
+                _miss_count {0},
+                _eviction_count {0} {
+            usize count = 1;
+
+            while(count < shard_count) {
+                count <<= 1U;
+            }
+
+            _shards = std::make_unique<Shard[]>(count);// NOLINT
+            _shard_mask = count - 1;
+            _shard_capacity = std::max<usize>((capacity + count - 1) / count, 1);
+        }
+
+        ~DnsCache() noexcept = default;
+
+        /**
+         * Returns the cached response or error for the given name and record type along with
+         * the age and remaining TTL of the entry, or nothing if there is no entry or it has expired.
+         */
+        [[nodiscard]] inline auto find(const std::string& name, u16 type) -> std::optional<DnsCacheHit<T>> {
+            const auto key = make_key(name, type);
+            auto& shard = get_shard(key);
+            const std::lock_guard lock {shard.mutex};
+            const auto iterator = shard.index.find(key);
+
+            if(iterator == shard.index.end()) {
+                _miss_count.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            const auto now = Clock::now();
+
+            if(iterator->second->expiry <= now) {
+                shard.entries.erase(iterator->second);
+                shard.index.erase(iterator);
+                _miss_count.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            shard.entries.splice(shard.entries.begin(), shard.entries, iterator->second);
+            _hit_count.fetch_add(1, std::memory_order_relaxed);
+            const auto& entry = shard.entries.front();
+            const auto age = std::chrono::duration_cast<std::chrono::seconds>(now - entry.insertion);
+            const auto remaining_ttl = std::chrono::duration_cast<std::chrono::seconds>(entry.expiry - now);
+
+            if(!entry.value) {
+                _negative_hit_count.fetch_add(1, std::memory_order_relaxed);
+                return DnsCacheHit<T> {Error {entry.error}, age, remaining_ttl};
+            }
+
+            return DnsCacheHit<T> {*entry.value, age, remaining_ttl};
+        }
+
+        inline auto insert(const std::string& name, u16 type, T value, std::chrono::seconds ttl) -> void {
+            insert_entry(make_key(name, type), std::move(value), {}, ttl);
+        }
+
+        inline auto insert_negative(const std::string& name, u16 type, std::string error, std::chrono::seconds ttl)
+                -> void {
+            insert_entry(make_key(name, type), std::nullopt, std::move(error), ttl);
+        }
+
+        inline auto clear() -> void {
+            for(usize index = 0; index <= _shard_mask; ++index) {
+                const std::lock_guard lock {_shards[index].mutex};
+                _shards[index].index.clear();
+                _shards[index].entries.clear();
+            }
+        }
+
+        [[nodiscard]] inline auto get_statistics() const -> DnsCacheStatistics {
+            usize size = 0;
+
+            for(usize index = 0; index <= _shard_mask; ++index) {
+                const std::lock_guard lock {_shards[index].mutex};
+                size += _shards[index].entries.size();
+            }
+
+            return {_hit_count.load(std::memory_order_relaxed), _negative_hit_count.load(std::memory_order_relaxed),
+                    _miss_count.load(std::memory_order_relaxed), _eviction_count.load(std::memory_order_relaxed),
+                    size};
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _shard_capacity * (_shard_mask + 1);
+        }
+    };
+}// namespace kstd::platform
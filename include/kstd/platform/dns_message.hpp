@@ -0,0 +1,392 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "kstd/platform/platform.hpp"
+#include "kstd/platform/small_vector.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fmt/format.h>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef PLATFORM_WINDOWS
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#endif
+
+namespace kstd::platform {
+    inline constexpr usize dns_header_size = 12;
+    inline constexpr usize dns_question_size = 4;
+    inline constexpr usize dns_record_size = 10;
+    inline constexpr usize dns_max_name_length = 255;
+    inline constexpr usize dns_max_label_length = 63;
+    inline constexpr usize dns_max_query_size = dns_header_size + dns_max_name_length + dns_question_size;
+    inline constexpr usize dns_max_udp_size = 512;
+    inline constexpr u16 dns_type_a = 1;
+    inline constexpr u16 dns_type_cname = 5;
+    inline constexpr u16 dns_type_soa = 6;
+    inline constexpr u16 dns_type_aaaa = 28;
+
+    enum class DnsResponseCode : u8 {
+        NO_ERROR = 0,
+        FORMAT_ERROR = 1,
+        SERVER_FAILURE = 2,
+        NAME_ERROR = 3,
+        NOT_IMPLEMENTED = 4,
+        REFUSED = 5
+    };
+
+    struct DnsHeader final {
+        u16 id;
+        u16 flags;
+        u16 question_count;
+        u16 answer_count;
+        u16 authority_count;
+        u16 additional_count;
+
+        [[nodiscard]] constexpr auto is_response() const noexcept -> bool {
+            return (flags & 0x8000U) != 0;
+        }
+
+        [[nodiscard]] constexpr auto is_truncated() const noexcept -> bool {
+            return (flags & 0x0200U) != 0;
+        }
+
+        [[nodiscard]] constexpr auto get_response_code() const noexcept -> DnsResponseCode {
+            return static_cast<DnsResponseCode>(flags & 0x000FU);
+        }
+    };
+
+    struct DnsAddress final {
+        std::array<u8, 16> bytes;
+        u8 size;
+        u32 ttl;
+
+        [[nodiscard]] constexpr auto is_ipv6() const noexcept -> bool {
+            return size == sizeof(in6_addr);
+        }
+
+        [[nodiscard]] inline auto to_ipv4() const noexcept -> in_addr {
+            in_addr address {};
+            std::memcpy(&address, bytes.data(), sizeof(address));
+            return address;
+        }
+
+        [[nodiscard]] inline auto to_ipv6() const noexcept -> in6_addr {
+            in6_addr address {};
+            std::memcpy(&address, bytes.data(), sizeof(address));
+            return address;
+        }
+
+        [[nodiscard]] inline auto to_string() const -> std::string {
+            std::array<char, INET6_ADDRSTRLEN> buffer {};
+            ::inet_ntop(is_ipv6() ? AF_INET6 : AF_INET, bytes.data(), buffer.data(), buffer.size());
+            return std::string {buffer.data()};
+        }
+    };
+
+    /**
+     * The addresses of a DNS response, along with the aliases which led to them. Up to
+     * four addresses are stored inline, which covers almost every response without
+     * allocating. For negative responses, the TTL is the one of the SOA record.
+     */
+    struct DnsAnswer final {
+        SmallVector<DnsAddress, 4> addresses;
+        std::vector<std::string> cnames;
+        u32 ttl;
+        DnsResponseCode response_code;
+
+        [[nodiscard]] inline auto is_negative() const noexcept -> bool {
+            return response_code == DnsResponseCode::NAME_ERROR ||
+                   (response_code == DnsResponseCode::NO_ERROR && addresses.empty());
+        }
+    };
+
+    [[nodiscard]] inline auto get_loopback_answer(bool is_ipv6) -> DnsAnswer {
+        DnsAnswer answer {{}, {}, 0, DnsResponseCode::NO_ERROR};
+        DnsAddress address {{}, static_cast<u8>(is_ipv6 ? sizeof(in6_addr) : sizeof(in_addr)), 0};
+
+        if(is_ipv6) {
+            address.bytes[15] = 1;
+        }
+        else {
+            address.bytes = {127, 0, 0, 1};
+        }
+
+        answer.addresses.push_back(address);
+        return answer;
+    }
+
+    [[nodiscard]] constexpr auto read_dns_u16(const u8* data) noexcept -> u16 {
+        return static_cast<u16>((data[0] << 8U) | data[1]);// NOLINT
+    }
+
+    [[nodiscard]] constexpr auto read_dns_u32(const u8* data) noexcept -> u32 {
+        return (static_cast<u32>(read_dns_u16(data)) << 16U) | read_dns_u16(data + 2);// NOLINT
+    }
+
+    [[nodiscard]] inline auto parse_dns_header(const u8* data, usize size) noexcept -> std::optional<DnsHeader> {
+        if(size < dns_header_size) {
+            return std::nullopt;
+        }
+
+        return DnsHeader {read_dns_u16(data),     read_dns_u16(data + 2), read_dns_u16(data + 4),  // NOLINT
+                          read_dns_u16(data + 6), read_dns_u16(data + 8), read_dns_u16(data + 10)};// NOLINT
+    }
+
+    /**
+     * Returns the offset past the possibly compressed name at the given offset,
+     * or nothing if it runs past the end of the message.
+     */
+    [[nodiscard]] inline auto skip_dns_name(const u8* data, usize size, usize offset) noexcept -> std::optional<usize> {
+        while(offset < size) {
+            const auto length = data[offset];// NOLINT
+
+            if((length & 0xC0U) == 0xC0U) {
+                return offset + 2 <= size ? std::optional<usize> {offset + 2} : std::nullopt;
+            }
+
+            if(length == 0) {
+                return offset + 1;
+            }
+
+            offset += length + 1;
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * Expands the possibly compressed name at the given offset into the given buffer
+     * in dotted form, returning its length or nothing if it is malformed.
+     */
+    [[nodiscard]] inline auto read_dns_name(const u8* data, usize size, usize offset,
+                                            std::array<char, dns_max_name_length + 1>& buffer) noexcept
+            -> std::optional<usize> {
+        usize length = 0;
+
+        // Every pointer has to point backwards, which rules out loops
+        for(auto limit = offset; offset < size;) {
+            const auto label_length = data[offset];// NOLINT
+
+            if((label_length & 0xC0U) == 0xC0U) {
+                if(offset + 2 > size) {
+                    return std::nullopt;
+                }
+
+                const auto target = static_cast<usize>(read_dns_u16(data + offset) & 0x3FFFU);// NOLINT
+
+                if(target >= limit) {
+                    return std::nullopt;
+                }
+
+                offset = limit = target;
+                continue;
+            }
+
+            if(label_length == 0) {
+                buffer[length] = '\0';// NOLINT
+                return length;
+            }
+
+            if(offset + 1 + label_length > size || length + label_length + 1 > dns_max_name_length) {
+                return std::nullopt;
+            }
+
+            if(length != 0) {
+                buffer[length++] = '.';// NOLINT
+            }
+
+            std::memcpy(buffer.data() + length, data + offset + 1, label_length);// NOLINT
+            length += label_length;
+            offset += label_length + 1;
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * Writes a recursive query for the given name and type into the buffer, returning
+     * its size, or nothing if the name is malformed.
+     */
+    [[nodiscard]] inline auto write_dns_query(u16 id, std::string_view name, u16 type,
+                                              std::array<u8, dns_max_query_size>& buffer) noexcept
+            -> std::optional<usize> {
+        if(!name.empty() && name.back() == '.') {
+            name.remove_suffix(1);
+        }
+
+        if(name.empty() || name.size() + 2 > dns_max_name_length) {
+            return std::nullopt;
+        }
+
+        const std::array<u16, 6> header {id, 0x0100, 1, 0, 0, 0};// Recursion desired, one question
+        auto offset = usize {0};
+
+        for(const auto field : header) {
+            buffer[offset++] = static_cast<u8>(field >> 8U);
+            buffer[offset++] = static_cast<u8>(field & 0xFFU);
+        }
+
+        while(!name.empty()) {
+            const auto label = name.substr(0, name.find('.'));
+
+            if(label.empty() || label.size() > dns_max_label_length) {
+                return std::nullopt;
+            }
+
+            buffer[offset++] = static_cast<u8>(label.size());
+            std::memcpy(buffer.data() + offset, label.data(), label.size());// NOLINT
+            offset += label.size();
+            name.remove_prefix(std::min(label.size() + 1, name.size()));
+        }
+
+        buffer[offset++] = 0;
+        buffer[offset++] = static_cast<u8>(type >> 8U);
+        buffer[offset++] = static_cast<u8>(type & 0xFFU);
+        buffer[offset++] = 0;
+        buffer[offset++] = 1;// Internet class
+        return offset;
+    }
+
+    /**
+     * Returns whether the given response answers the given query, which requires the same
+     * ID and question. Names are compared ignoring case, as servers may change it.
+     */
+    [[nodiscard]] inline auto is_dns_response_to(const u8* query, usize query_size, const u8* response,
+                                                 usize response_size) noexcept -> bool {
+        const auto header = parse_dns_header(response, response_size);
+
+        if(!header || !header->is_response() || header->question_count != 1 || response_size < query_size ||
+           header->id != read_dns_u16(query)) {
+            return false;
+        }
+
+        for(auto offset = dns_header_size; offset < query_size; ++offset) {
+            const auto lhs = query[offset];   // NOLINT
+            const auto rhs = response[offset];// NOLINT
+
+            if(lhs != rhs && (lhs | 0x20U) != (rhs | 0x20U)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Parses the addresses of the given type out of a DNS response, directly from the buffer
+     * it was received into. Negative responses parse successfully, their TTL is taken
+     * from the SOA record of the authority section as described in RFC 2308.
+     */
+    [[nodiscard]] inline auto parse_dns_answer(const u8* data, usize size, u16 type) noexcept -> Result<DnsAnswer> {
+        const auto header = parse_dns_header(data, size);
+
+        if(!header || !header->is_response()) {
+            return Error {std::string("Unable to parse DNS response: Not a response")};
+        }
+
+        DnsAnswer answer {{}, {}, 0, header->get_response_code()};
+        std::optional<u32> ttl {};
+        auto offset = dns_header_size;
+
+        for(auto question = header->question_count; question > 0; --question) {
+            const auto name_end = skip_dns_name(data, size, offset);
+
+            if(!name_end) {
+                return Error {std::string("Unable to parse DNS response: Malformed question")};
+            }
+
+            offset = *name_end + dns_question_size;
+        }
+
+        const auto record_count = static_cast<usize>(header->answer_count) + header->authority_count;
+
+        for(usize record = 0; record < record_count; ++record) {
+            const auto name_end = skip_dns_name(data, size, offset);
+
+            if(!name_end || *name_end + dns_record_size > size) {
+                return Error {std::string("Unable to parse DNS response: Malformed record")};
+            }
+
+            const auto* fields = data + *name_end;// NOLINT
+            const auto record_type = read_dns_u16(fields);
+            const auto record_ttl = read_dns_u32(fields + 4);      // NOLINT
+            const auto data_length = read_dns_u16(fields + 8);     // NOLINT
+            const auto data_offset = *name_end + dns_record_size;
+
+            if(data_offset + data_length > size) {
+                return Error {std::string("Unable to parse DNS response: Record exceeds message")};
+            }
+
+            offset = data_offset + data_length;
+
+            if(record >= header->answer_count) {
+                if(record_type != dns_type_soa) {
+                    continue;
+                }
+
+                // The minimum field is the last of five 32-bit fields following two names
+                if(answer.is_negative() && data_length >= sizeof(u32) * 5) {
+                    const auto minimum = read_dns_u32(data + data_offset + data_length - sizeof(u32));// NOLINT
+                    answer.ttl = std::min(record_ttl, minimum);
+                }
+
+                break;
+            }
+
+            if(record_type == dns_type_cname) {
+                std::array<char, dns_max_name_length + 1> name {};
+                const auto length = read_dns_name(data, size, data_offset, name);
+
+                if(!length) {
+                    return Error {std::string("Unable to parse DNS response: Malformed alias")};
+                }
+
+                answer.cnames.emplace_back(name.data(), *length);
+            }
+            else if(record_type != type) {
+                continue;
+            }
+            else if((type == dns_type_a && data_length == 4) || (type == dns_type_aaaa && data_length == 16)) {
+                DnsAddress address {{}, static_cast<u8>(data_length), record_ttl};
+                std::memcpy(address.bytes.data(), data + data_offset, data_length);// NOLINT
+                answer.addresses.push_back(address);
+            }
+            else {
+                continue;
+            }
+
+            ttl = std::min(ttl.value_or(record_ttl), record_ttl);
+        }
+
+        if(!answer.is_negative()) {
+            answer.ttl = ttl.value_or(0);
+        }
+
+        return answer;
+    }
+}// namespace kstd::platform
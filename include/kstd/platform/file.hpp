@@ -25,6 +25,7 @@
 #include <kstd/types.hpp>
 
 #include "file_handle.hpp"
+#include "page_residency.hpp"
 #include "platform.hpp"
 
 namespace kstd::platform::file {
@@ -34,6 +35,29 @@ namespace kstd::platform::file {
         READ_WRITE
     };
 
+    struct FileIdentity final {
+        u64 device;
+        u64 inode;
+
+        [[nodiscard]] constexpr auto operator==(const FileIdentity& other) const noexcept -> bool {
+            return device == other.device && inode == other.inode;
+        }
+
+        [[nodiscard]] constexpr auto operator!=(const FileIdentity& other) const noexcept -> bool {
+            return !(*this == other);
+        }
+    };
+
+    struct CacheStatistics final {
+        usize page_size;
+        usize page_count;
+        usize cached_page_count;
+        usize dirty_page_count;
+        usize writeback_page_count;
+        usize evicted_page_count;
+        usize recently_evicted_page_count;
+    };
+
     class File final {
         std::filesystem::path _path;
         FileMode _mode;
@@ -57,8 +81,24 @@ namespace kstd::platform::file {
 
         [[nodiscard]] auto get_size() const noexcept -> Result<usize>;
 
+        [[nodiscard]] auto get_identity() const noexcept -> Result<FileIdentity>;
+
         [[nodiscard]] auto resize(usize size) const noexcept -> Result<void>;
 
+        /**
+         * Returns how many pages of the given byte range are held in the page cache,
+         * where a size of 0 extends the range to the end of the file.
+         * Only cachestat on Linux 6.5+ reports dirty, writeback and eviction counts.
+         */
+        [[nodiscard]] auto get_cache_statistics(usize offset = 0, usize size = 0) const noexcept
+                -> Result<CacheStatistics>;
+
+        /**
+         * Returns which pages of the given byte range are held in the page cache,
+         * where a size of 0 extends the range to the end of the file.
+         */
+        [[nodiscard]] auto get_residency(usize offset = 0, usize size = 0) const noexcept -> Result<PageResidency>;
+
         [[nodiscard]] auto set_executable(bool is_executable = true) const noexcept -> Result<void>;
 
         [[nodiscard]] auto is_executable() const noexcept -> Result<bool>;
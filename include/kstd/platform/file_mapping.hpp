@@ -19,42 +19,208 @@
 
 #pragma once
 
+#include "dirty_page_map.hpp"
 #include "memory_mapping.hpp"
+#include "write_tracker.hpp"
+#include <algorithm>
 #include <filesystem>
+#include <kstd/safe_alloc.hpp>
+#include <stdexcept>
+#include <vector>
 
 namespace kstd::platform::mm {
     class FileMapping final : public MemoryMapping {
         file::File _file;
         MappingType _type;
         MappingAccess _access;
+        MappingFlags _flags;
         void* _address;
+        usize _size;
+        DirtyPageMap _dirty_pages;
+        WriteTracker _write_tracker;
 
 #ifdef PLATFORM_WINDOWS
         file::FileHandle _handle {};
 #endif
 
+        [[nodiscard]] auto map(usize size) noexcept -> Result<void*>;
+
+        // Checked before the file is opened, so a rejected mapping never creates the file
+        [[nodiscard]] static inline auto derive_checked_file_mode(MappingAccess access, MappingFlags flags)
+                -> file::FileMode {
+            const auto is_writable = (access & MappingAccess::WRITE) == MappingAccess::WRITE;
+
+            if(is_writable && (access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE) {
+                throw std::runtime_error {"Could not map file writable and executable at once"};
+            }
+
+            return derive_file_mode(access, flags);
+        }
+
+        // Carries dirty pages and write tracking over after the mapping moved or changed its size
+        [[nodiscard]] inline auto rebind(void* address, usize size, bool is_tracking) noexcept -> Result<void> {
+            DirtyPageMap dirty_pages {size};
+
+            for(const auto& range : _dirty_pages.get_ranges()) {
+                if(range.offset < size) {
+                    dirty_pages.mark({range.offset, std::min(range.size, size - range.offset)});
+                }
+            }
+
+            _address = address;
+            _size = size;
+            _dirty_pages = std::move(dirty_pages);
+            return is_tracking ? set_write_tracking(true) : Result<void> {};
+        }
+
         public:
         FileMapping(const FileMapping& other);
         FileMapping(FileMapping&& other) noexcept;
         FileMapping() noexcept;
 
-        FileMapping(std::filesystem::path path, MappingAccess access);
+        /**
+         * Maps the given file, growing an empty file to a single byte first.
+         * An empty file cannot be mapped with MappingFlags::PRIVATE, since a
+         * private mapping never changes the file, so this throws instead.
+         * Mapping a file writable and executable at once throws as well,
+         * generated code belongs into a CodeAllocator.
+         */
+        FileMapping(std::filesystem::path path, MappingAccess access, MappingFlags flags = MappingFlags::NONE);
 
         ~FileMapping() noexcept;
 
         auto operator=(const FileMapping& other) -> FileMapping&;
         auto operator=(FileMapping&& other) noexcept -> FileMapping&;
 
+        /**
+         * Resizes the file and remaps it, which may move the mapping to a new address.
+         * Dirty pages and write tracking are carried over.
+         */
         [[nodiscard]] auto resize(usize size) noexcept -> Result<void> final;
 
+        using MemoryMapping::sync;
+
         [[nodiscard]] auto sync() noexcept -> Result<void> final;
 
+#ifdef PLATFORM_WINDOWS
+
+        [[nodiscard]] auto sync(MappingRange range, SyncFlags flags = SyncFlags::NONE) noexcept -> Result<void> final;
+
+#endif
+
         [[nodiscard]] auto get_type() const noexcept -> MappingType final;
 
         [[nodiscard]] auto get_access() const noexcept -> MappingAccess final;
 
         [[nodiscard]] auto get_address() const noexcept -> void* final;
 
+        [[nodiscard]] auto get_size() const noexcept -> usize final;
+
+        [[nodiscard]] inline auto get_flags() const noexcept -> MappingFlags {
+            return _flags;
+        }
+
+        /**
+         * Remembers the given range as modified, so that the next call to
+         * flush only has to write back the pages which were actually changed.
+         */
+        [[nodiscard]] inline auto mark_dirty(MappingRange range) noexcept -> Result<void> {
+            if(!range.is_within(_size)) {
+                return Error {fmt::format("Could not mark range {}..{} dirty: exceeds mapping size {}", range.offset,
+                                          range.get_end(), _size)};
+            }
+
+            _dirty_pages.mark(range);
+            return {};
+        }
+
+        /**
+         * Enables or disables automatic write tracking. While enabled, the mapping
+         * is write-protected and the first write to every page marks it dirty.
+         * At most 64 mappings can be tracked at once in the whole process.
+         * Only faulting writes of the process itself are recorded, system calls
+         * which write into a protected page (like read() into the mapping) fail
+         * with EFAULT instead, so they need write tracking to be disabled.
+         */
+        [[nodiscard]] inline auto set_write_tracking(bool is_enabled) noexcept -> Result<void> {
+            if(is_enabled == _write_tracker.is_active()) {
+                return {};
+            }
+
+            if(!is_enabled) {
+                _write_tracker = WriteTracker {};
+                return {};
+            }
+
+            auto tracker_result = try_construct<WriteTracker>(_address, _size, _access, _dirty_pages);
+
+            if(!tracker_result) {
+                return tracker_result.forward<void>();
+            }
+
+            _write_tracker = std::move(*tracker_result);
+            return {};
+        }
+
+        /**
+         * Returns all dirty ranges and clears them. When write tracking is
+         * enabled, the returned pages are write-protected again so the next
+         * write to them is recorded as well.
+         */
+        [[nodiscard]] inline auto take_dirty_ranges() noexcept -> Result<std::vector<MappingRange>> {
+            auto ranges = _dirty_pages.take_ranges();
+
+            for(const auto& range : ranges) {
+                auto result = _write_tracker.protect(range);
+
+                if(!result) {
+                    for(const auto& dirty_range : ranges) {
+                        _dirty_pages.mark(dirty_range);
+                    }
+
+                    return result.forward<std::vector<MappingRange>>();
+                }
+            }
+
+            return ranges;
+        }
+
+        /**
+         * Synchronizes all dirty pages with the underlying file.
+         * Ranges which could not be written back stay marked.
+         */
+        [[nodiscard]] inline auto flush(SyncFlags flags = SyncFlags::NONE) noexcept -> Result<void> {
+            auto ranges_result = take_dirty_ranges();
+
+            if(!ranges_result) {
+                return ranges_result.forward<void>();
+            }
+
+            const auto& ranges = *ranges_result;
+
+            for(auto iterator = ranges.cbegin(); iterator != ranges.cend(); ++iterator) {
+                auto result = sync(*iterator, flags);
+
+                if(!result) {
+                    for(; iterator != ranges.cend(); ++iterator) {
+                        _dirty_pages.mark(*iterator);
+                    }
+
+                    return result;
+                }
+            }
+
+            return {};
+        }
+
+        [[nodiscard]] inline auto is_write_tracking() const noexcept -> bool {
+            return _write_tracker.is_active();
+        }
+
+        [[nodiscard]] inline auto get_dirty_pages() noexcept -> DirtyPageMap& {
+            return _dirty_pages;
+        }
+
         [[nodiscard]] inline auto get_file() const noexcept -> const file::File& {
             return _file;
         }
@@ -0,0 +1,110 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "memory_mapping.hpp"
+#include <chrono>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+
+namespace kstd::platform::mm {
+    enum class PageContent : u8 {
+        DATA,
+        ZERO
+    };
+
+    /**
+     * Produces the page at the given offset of a LazyMapping into a page-sized buffer,
+     * or reports that it is all zeroes so the shared zero page can be mapped instead.
+     * Called from the fault handler thread, one page at a time.
+     */
+    using PageProvider = std::function<Result<PageContent>(usize offset, void* page, usize page_size)>;
+
+    struct LazyMappingStatistics final {
+        usize fault_count;
+        usize zero_page_count;
+        usize failed_fault_count;
+        std::chrono::nanoseconds total_latency;
+        std::chrono::nanoseconds max_latency;
+
+        [[nodiscard]] inline auto get_average_latency() const noexcept -> std::chrono::nanoseconds {
+            if(fault_count == 0) {
+                return std::chrono::nanoseconds {0};
+            }
+
+            return total_latency / static_cast<std::chrono::nanoseconds::rep>(fault_count);
+        }
+    };
+
+    struct LazyMappingState;
+
+    /**
+     * An anonymous mapping whose pages are produced by a PageProvider the first time
+     * they are touched, e.g. by decompressing a block, instead of all of them up front.
+     * Faults are resolved by a handler thread per mapping through userfaultfd, so this
+     * is only available on Linux. When a page fails to be provided, the faulting thread
+     * receives SIGBUS, like it would past the end of a mapped file, and the fault counts
+     * as failed. The page stays missing, so it is requested again once a signal handler
+     * returns. Advising DONT_NEED drops pages, which are provided again on their next
+     * access. Only faults from user space are handled, passing the mapping to a syscall
+     * before its pages are populated fails with EFAULT.
+     */
+    class LazyMapping final : public MemoryMapping {
+        std::unique_ptr<LazyMappingState> _state;
+        u8* _address;
+        usize _size;
+        MappingAccess _access;
+
+        public:
+        LazyMapping(LazyMapping&& other) noexcept;
+        LazyMapping() noexcept;
+        LazyMapping(usize size, PageProvider provider,
+                    MappingAccess access = MappingAccess::READ | MappingAccess::WRITE);
+
+        ~LazyMapping() noexcept;
+
+        auto operator=(LazyMapping&& other) noexcept -> LazyMapping&;
+
+        KSTD_NO_COPY(LazyMapping, LazyMapping)
+
+        [[nodiscard]] auto resize(usize size) noexcept -> Result<void> final;
+
+        using MemoryMapping::sync;
+
+        [[nodiscard]] auto sync() noexcept -> Result<void> final;
+
+        [[nodiscard]] auto get_type() const noexcept -> MappingType final;
+
+        [[nodiscard]] auto get_access() const noexcept -> MappingAccess final;
+
+        [[nodiscard]] auto get_address() const noexcept -> void* final;
+
+        [[nodiscard]] auto get_size() const noexcept -> usize final;
+
+        /**
+         * Returns how many faults were resolved so far and how long resolving them
+         * took, measured from reading the fault until its page was mapped.
+         */
+        [[nodiscard]] auto get_statistics() const noexcept -> LazyMappingStatistics;
+    };
+}// namespace kstd::platform::mm
@@ -0,0 +1,476 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "file_mapping.hpp"
+#include "ring_mapping.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/safe_alloc.hpp>
+#include <kstd/types.hpp>
+#include <mutex>
+#include <new>
+#include <system_error>
+
+namespace kstd::platform::mm {
+    struct LogSegmentHeader final {
+        static constexpr u64 magic_value = 0x4D474553'474F4C4BULL;// "KLOGSEGM"
+        static constexpr u32 current_version = 1;
+
+        std::atomic<u64> magic;
+        u32 version;
+        u32 reserved;
+        u64 capacity;
+        u64 index;
+        alignas(64) std::atomic<u64> tail;
+    };
+
+    static_assert(std::atomic<u64>::is_always_lock_free, "Log segments require lock-free 64-bit atomics");
+    static_assert(sizeof(std::atomic<u64>) == sizeof(u64), "Log segments require plain 64-bit atomics");
+
+    struct LogRecord final {
+        const u8* data;
+        usize size;
+        usize next_offset;
+
+        [[nodiscard]] constexpr auto is_valid() const noexcept -> bool {
+            return data != nullptr;
+        }
+    };
+
+    struct LogPosition final {
+        u64 segment;
+        usize offset;
+    };
+
+    /**
+     * A fixed-size, append-only sequence of records inside of a file. Any number of writers
+     * reserve space with a single fetch-add on the tail, copy their record into the mapping
+     * and publish it by storing its length word, which doubles as the commit marker.
+     * Readers in any process follow the commit markers and never need a syscall.
+     */
+    class LogSegment final {
+        static constexpr u64 committed_bit = u64 {1} << 63U;
+        static constexpr u64 reserved_bit = u64 {1} << 62U;// Set with committed_bit, the record was abandoned
+        static constexpr u64 size_mask = ~(committed_bit | reserved_bit);
+        static constexpr u64 end_marker = ~u64 {0};
+        static constexpr usize record_alignment = alignof(u64);
+        static constexpr usize header_size = sizeof(LogSegmentHeader);
+
+        FileMapping _mapping;
+        LogSegmentHeader* _header;
+        u8* _data;
+        usize _capacity;
+
+        [[nodiscard]] static constexpr auto get_record_size(usize size) noexcept -> usize {
+            return (sizeof(u64) + size + record_alignment - 1) & ~(record_alignment - 1);
+        }
+
+        [[nodiscard]] inline auto get_marker(usize offset) const noexcept -> std::atomic<u64>& {
+            return *reinterpret_cast<std::atomic<u64>*>(_data + offset);// NOLINT
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE(LogSegment, LogSegment)
+        KSTD_NO_COPY(LogSegment, LogSegment)
+
+        LogSegment() noexcept :
+                _header {nullptr},
+                _data {nullptr},
+                _capacity {0} {
+        }
+
+        /**
+         * Opens the segment stored in the given file, or creates it with room for the given
+         * number of bytes of records if the file is empty. The capacity is rounded down
+         * to the record alignment, and a capacity of zero only allows opening.
+         */
+        explicit LogSegment(std::filesystem::path path, usize capacity = 0, u64 index = 0) :
+                _mapping {std::move(path), MappingAccess::READ | MappingAccess::WRITE},
+                _header {nullptr},
+                _data {nullptr},
+                _capacity {capacity & ~(record_alignment - 1)} {
+            const auto path_string = _mapping.get_file().get_path().string();
+
+            if(_mapping.get_size() < header_size) {
+                if(_capacity == 0) {
+                    throw std::runtime_error {fmt::format("Could not open log segment {}: empty file", path_string)};
+                }
+
+                // Growing a file fills it with zeroes, which marks every record as uncommitted
+                _mapping.resize(header_size + _capacity).throw_if_error();
+                _header = static_cast<LogSegmentHeader*>(_mapping.get_address());
+                new(_header) LogSegmentHeader {{0}, LogSegmentHeader::current_version, 0, _capacity, index, {0}};
+                _header->magic.store(LogSegmentHeader::magic_value, std::memory_order_release);
+            }
+
+            _header = static_cast<LogSegmentHeader*>(_mapping.get_address());
+            _data = static_cast<u8*>(_mapping.get_address()) + header_size;// NOLINT
+            _capacity = static_cast<usize>(_header->capacity);
+
+            if(_header->magic.load(std::memory_order_acquire) != LogSegmentHeader::magic_value ||
+               _header->version != LogSegmentHeader::current_version) {
+                throw std::runtime_error {fmt::format("Could not open log segment {}: invalid header", path_string)};
+            }
+
+            if(_mapping.get_size() < header_size + _capacity || (_capacity & (record_alignment - 1)) != 0) {
+                throw std::runtime_error {fmt::format("Could not open log segment {}: corrupted layout", path_string)};
+            }
+        }
+
+        ~LogSegment() noexcept = default;
+
+        /**
+         * Claims space for a record of the given size, which may be written directly
+         * and must be committed afterwards. Returns an invalid region once the segment
+         * is full, in which case the writer which overran it first seals the segment.
+         */
+        [[nodiscard]] inline auto try_reserve(usize size) noexcept -> RingRegion {
+            const auto record_size = get_record_size(size);
+
+            if(record_size > _capacity) {
+                return {nullptr, 0, 0};
+            }
+
+            const auto offset = static_cast<usize>(_header->tail.fetch_add(record_size, std::memory_order_relaxed));
+
+            if(offset + record_size > _capacity) {
+                // Reservations never overlap, so only one writer can straddle the end
+                if(offset < _capacity) {
+                    get_marker(offset).store(end_marker, std::memory_order_release);
+                }
+
+                return {nullptr, 0, offset};
+            }
+
+            // Records the size before anything else, so recover() can skip the record if its writer crashes
+            get_marker(offset).store(reserved_bit | static_cast<u64>(size), std::memory_order_relaxed);
+            return {_data + offset + sizeof(u64), size, offset};// NOLINT
+        }
+
+        inline auto commit(const RingRegion& region) noexcept -> void {
+            get_marker(static_cast<usize>(region.position))
+                    .store(committed_bit | static_cast<u64>(region.size), std::memory_order_release);
+        }
+
+        [[nodiscard]] inline auto try_append(const void* data, usize size) noexcept -> RingRegion {
+            auto region = try_reserve(size);
+
+            if(region.is_valid()) {
+                std::memcpy(region.data, data, size);
+                commit(region);
+            }
+
+            return region;
+        }
+
+        /**
+         * Returns the record at the given offset, or an invalid record
+         * if it has not been committed yet or the segment ends there.
+         * Abandoned records are skipped, so the offset of an invalid
+         * record tells where to continue reading.
+         */
+        [[nodiscard]] inline auto read(usize offset) const noexcept -> LogRecord {
+            while(offset + sizeof(u64) <= _capacity) {
+                const auto marker = get_marker(offset).load(std::memory_order_acquire);
+
+                if((marker & committed_bit) == 0 || marker == end_marker) {
+                    break;
+                }
+
+                const auto size = static_cast<usize>(marker & size_mask);
+
+                if((marker & reserved_bit) == 0) {
+                    return {_data + offset + sizeof(u64), size, offset + get_record_size(size)};// NOLINT
+                }
+
+                offset += get_record_size(size);
+            }
+
+            return {nullptr, 0, offset};
+        }
+
+        /**
+         * Marks every reservation which was never committed, because its writer crashed, as
+         * abandoned so readers skip it. A reservation whose size was never recorded can't be
+         * skipped, so the segment is sealed there instead and the records behind it are lost.
+         * Must not be called while anybody appends to the segment.
+         */
+        inline auto recover() noexcept -> void {
+            const auto tail = std::min(static_cast<usize>(_header->tail.load(std::memory_order_relaxed)), _capacity);
+            usize offset = 0;
+
+            while(offset + sizeof(u64) <= tail) {
+                auto& marker = get_marker(offset);
+                const auto value = marker.load(std::memory_order_acquire);
+
+                if(value == end_marker) {
+                    return;
+                }
+
+                if((value & committed_bit) == 0) {
+                    if((value & reserved_bit) == 0) {
+                        marker.store(end_marker, std::memory_order_release);
+                        _header->tail.store(_capacity, std::memory_order_relaxed);// Makes writers roll over
+                        return;
+                    }
+
+                    marker.store(committed_bit | value, std::memory_order_release);
+                }
+
+                offset += get_record_size(static_cast<usize>(value & size_mask));
+            }
+        }
+
+        [[nodiscard]] inline auto is_end(usize offset) const noexcept -> bool {
+            return offset + sizeof(u64) > _capacity ||
+                   get_marker(offset).load(std::memory_order_acquire) == end_marker;
+        }
+
+        [[nodiscard]] inline auto is_full() const noexcept -> bool {
+            return _header->tail.load(std::memory_order_relaxed) >= _capacity;
+        }
+
+        [[nodiscard]] inline auto sync(SyncFlags flags = SyncFlags::NONE) noexcept -> Result<void> {
+            const auto tail = std::min(static_cast<usize>(_header->tail.load(std::memory_order_relaxed)), _capacity);
+            return _mapping.sync({0, header_size + tail}, flags);
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return std::min(static_cast<usize>(_header->tail.load(std::memory_order_relaxed)), _capacity);
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _capacity;
+        }
+
+        [[nodiscard]] inline auto get_max_record_size() const noexcept -> usize {
+            return _capacity - sizeof(u64);
+        }
+
+        [[nodiscard]] inline auto get_index() const noexcept -> u64 {
+            return _header->index;
+        }
+
+        [[nodiscard]] inline auto get_mapping() noexcept -> FileMapping& {
+            return _mapping;
+        }
+    };
+
+    [[nodiscard]] inline auto get_log_segment_path(const std::filesystem::path& directory, u64 index)
+            -> std::filesystem::path {
+        return directory / fmt::format("{:016}.log", index);
+    }
+
+    /**
+     * A log made of a directory of equally sized segments. Appending is lock-free
+     * until the current segment fills, at which point the first writer to notice
+     * creates the next segment and everyone moves over to it. Segments stay mapped
+     * for the lifetime of the log, since writers may still be using older ones.
+     */
+    class MappedLog final {
+        std::filesystem::path _directory;
+        usize _segment_size;
+        std::mutex _mutex;
+        std::deque<LogSegment> _segments;
+        std::atomic<LogSegment*> _current;
+
+        [[nodiscard]] inline auto roll_over(LogSegment* full_segment) noexcept -> Result<void> {
+            const std::lock_guard lock {_mutex};
+
+            if(_current.load(std::memory_order_acquire) != full_segment) {
+                return {};// Somebody else was faster
+            }
+
+            // Build the segment under a temporary name, so readers never observe it half-initialized
+            const auto index = full_segment->get_index() + 1;
+            const auto path = get_log_segment_path(_directory, index);
+            auto temporary_path = path;
+            temporary_path += ".tmp";
+            std::error_code error {};
+            std::filesystem::remove(temporary_path, error);// A leftover of a rollover which crashed midway
+
+            {
+                auto segment = try_construct<LogSegment>(temporary_path, _segment_size, index);
+
+                if(!segment) {
+                    return segment.forward<void>();
+                }
+            }
+
+            std::filesystem::rename(temporary_path, path, error);
+
+            if(error) {
+                return Error {fmt::format("Could not create log segment {}: {}", path.string(), error.message())};
+            }
+
+            auto segment = try_construct<LogSegment>(path);
+
+            if(!segment) {
+                return segment.forward<void>();
+            }
+
+            _segments.push_back(std::move(*segment));
+            _current.store(&_segments.back(), std::memory_order_release);
+            return {};
+        }
+
+        public:
+        KSTD_NO_COPY(MappedLog, MappedLog)
+
+        /**
+         * Opens the log in the given directory and continues appending to its
+         * newest segment, or creates the directory and the first segment.
+         * Records which crashed writers left uncommitted are recovered in every
+         * segment, so no other process may append to the log while it is opened.
+         */
+        MappedLog(std::filesystem::path directory, usize segment_size) :
+                _directory {std::move(directory)},
+                _segment_size {segment_size},
+                _current {nullptr} {
+            std::filesystem::create_directories(_directory);
+            u64 index = 0;
+
+            while(std::filesystem::exists(get_log_segment_path(_directory, index + 1))) {
+                LogSegment {get_log_segment_path(_directory, index)}.recover();
+                ++index;
+            }
+
+            auto temporary_path = get_log_segment_path(_directory, index + 1);
+            temporary_path += ".tmp";
+            std::error_code error {};
+            std::filesystem::remove(temporary_path, error);// A leftover of a rollover which crashed midway
+
+            _segments.emplace_back(get_log_segment_path(_directory, index), _segment_size, index);
+            _segments.back().recover();
+            _current.store(&_segments.back(), std::memory_order_release);
+        }
+
+        ~MappedLog() noexcept = default;
+
+        /**
+         * Appends a copy of the given record and returns where it was stored.
+         */
+        [[nodiscard]] inline auto append(const void* data, usize size) noexcept -> Result<LogPosition> {
+            while(true) {
+                auto* segment = _current.load(std::memory_order_acquire);
+
+                if(size > segment->get_max_record_size()) {
+                    return Error {fmt::format("Could not append {} byte record to log {}: exceeds segment size",
+                                              size, _directory.string())};
+                }
+
+                if(const auto region = segment->try_append(data, size); region.is_valid()) {
+                    return LogPosition {segment->get_index(), static_cast<usize>(region.position)};
+                }
+
+                if(auto result = roll_over(segment); !result) {
+                    return result.forward<LogPosition>();
+                }
+            }
+        }
+
+        [[nodiscard]] inline auto sync(SyncFlags flags = SyncFlags::NONE) noexcept -> Result<void> {
+            return _current.load(std::memory_order_acquire)->sync(flags);
+        }
+
+        [[nodiscard]] inline auto get_current_segment() const noexcept -> u64 {
+            return _current.load(std::memory_order_acquire)->get_index();
+        }
+
+        [[nodiscard]] inline auto get_directory() const noexcept -> const std::filesystem::path& {
+            return _directory;
+        }
+
+        [[nodiscard]] inline auto get_segment_size() const noexcept -> usize {
+            return _segment_size;
+        }
+    };
+
+    /**
+     * Follows a MappedLog from this or another process. Reading within a segment
+     * only touches the mapping, moving to the next one opens its file.
+     */
+    class MappedLogReader final {
+        std::filesystem::path _directory;
+        LogSegment _segment;
+        u64 _index;
+        usize _offset;
+
+        public:
+        KSTD_DEFAULT_MOVE(MappedLogReader, MappedLogReader)
+        KSTD_NO_COPY(MappedLogReader, MappedLogReader)
+
+        explicit MappedLogReader(std::filesystem::path directory, u64 index = 0) :
+                _directory {std::move(directory)},
+                _segment {get_log_segment_path(_directory, index)},
+                _index {index},
+                _offset {0} {
+        }
+
+        ~MappedLogReader() noexcept = default;
+
+        /**
+         * Returns the next committed record, or an invalid record if the writers
+         * haven't committed it yet. The record stays valid until the reader is destroyed
+         * or moves past the end of its segment.
+         */
+        [[nodiscard]] inline auto read() noexcept -> LogRecord {
+            while(true) {
+                const auto record = _segment.read(_offset);
+                _offset = record.next_offset;// Moves past abandoned records even if nothing follows yet
+
+                if(record.is_valid()) {
+                    return record;
+                }
+
+                if(!_segment.is_end(_offset)) {
+                    return {nullptr, 0, _offset};
+                }
+
+                const auto path = get_log_segment_path(_directory, _index + 1);
+                std::error_code error {};
+
+                if(!std::filesystem::exists(path, error)) {
+                    return {nullptr, 0, _offset};
+                }
+
+                auto segment = try_construct<LogSegment>(path);
+
+                if(!segment) {
+                    return {nullptr, 0, _offset};
+                }
+
+                _segment = std::move(*segment);
+                ++_index;
+                _offset = 0;
+            }
+        }
+
+        [[nodiscard]] inline auto get_position() const noexcept -> LogPosition {
+            return {_index, _offset};
+        }
+    };
+}// namespace kstd::platform::mm
@@ -0,0 +1,94 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+namespace kstd::platform::mm {
+    /**
+     * A non-owning, typed view of elements inside of a memory mapping.
+     * Bounds and alignment are validated once when the view is created
+     * through MemoryMapping, element access itself is unchecked.
+     */
+    template<typename T>
+    class MappedArray final {
+        static_assert(std::is_trivially_copyable_v<T>, "Mapped elements must be trivially copyable");
+
+        T* _data;
+        usize _size;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(MappedArray, MappedArray)
+
+        constexpr MappedArray() noexcept :
+                _data {nullptr},
+                _size {0} {
+        }
+
+        constexpr MappedArray(T* data, usize size) noexcept :
+                _data {data},
+                _size {size} {
+        }
+
+        ~MappedArray() noexcept = default;
+
+        [[nodiscard]] constexpr auto operator[](usize index) const noexcept -> T& {
+            return _data[index];// NOLINT
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> T* {
+            return _data;
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> T* {
+            return _data + _size;// NOLINT
+        }
+
+        [[nodiscard]] constexpr auto get_data() const noexcept -> T* {
+            return _data;
+        }
+
+        [[nodiscard]] constexpr auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] constexpr auto get_size_in_bytes() const noexcept -> usize {
+            return _size * sizeof(T);
+        }
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+#ifdef __cpp_lib_span
+
+        [[nodiscard]] constexpr operator std::span<T>() const noexcept {// NOLINT
+            return {_data, _size};
+        }
+
+#endif
+    };
+}// namespace kstd::platform::mm
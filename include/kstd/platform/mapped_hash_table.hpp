@@ -0,0 +1,477 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "file_mapping.hpp"
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/safe_alloc.hpp>
+#include <kstd/types.hpp>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define KSTD_MAPPED_HASH_TABLE_SSE2
+#endif
+
+namespace kstd::platform::mm {
+    /**
+     * A hash over the object representation of a key, which unlike std::hash
+     * is guaranteed to stay the same across runs and builds.
+     */
+    template<typename K>
+    struct MappedHash final {
+        static_assert(std::has_unique_object_representations_v<K>, "Keys must not contain padding bits");
+
+        [[nodiscard]] inline auto operator()(const K& key) const noexcept -> u64 {
+            const auto* bytes = reinterpret_cast<const u8*>(&key);// NOLINT
+            u64 hash = 0xCBF29CE484222325ULL;
+
+            for(usize index = 0; index < sizeof(K); ++index) {
+                hash = (hash ^ bytes[index]) * 0x100000001B3ULL;// NOLINT
+            }
+
+            // The tag is taken from the top bits, so mix them with the bottom ones
+            hash = (hash ^ (hash >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+            hash = (hash ^ (hash >> 27U)) * 0x94D049BB133111EBULL;
+            return hash ^ (hash >> 31U);
+        }
+    };
+
+    struct MappedHashTableHeader final {
+        static constexpr u64 magic_value = 0x4C425448'53414D4BULL;// "KMASHTBL"
+        static constexpr u32 current_version = 1;
+
+        u64 magic;
+        u32 version;
+        u32 key_size;
+        u32 value_size;
+        u32 slot_size;
+        u64 capacity;
+        u64 size;
+    };
+
+    /**
+     * A hash table of trivially copyable keys and values which lives in a file, so it
+     * is ready as soon as the file is mapped. It uses linear probing over fixed-size slots
+     * and a byte of tag per slot, 16 of which are matched at once with SSE2 where available.
+     * Growing builds the new table in a separate file which atomically replaces the old
+     * one, so a crash while resizing always leaves one complete table behind.
+     * Not thread-safe, and pointers to values are invalidated by any insertion.
+     */
+    template<typename K, typename V, typename HASH = MappedHash<K>, typename EQUAL = std::equal_to<K>>
+    class MappedHashTable final {
+        static_assert(std::is_trivially_copyable_v<K>, "Mapped hash tables can only hold trivially copyable keys");
+        static_assert(std::is_trivially_copyable_v<V>, "Mapped hash tables can only hold trivially copyable values");
+
+        public:
+        struct Slot final {
+            K key;
+            V value;
+        };
+
+        static constexpr usize group_size = 16;
+        static constexpr usize min_capacity = group_size;
+
+        private:
+        static constexpr u8 empty_tag = 0;
+        static constexpr usize header_size = 64;
+
+        struct View final {
+            MappedHashTableHeader* header;
+            u8* tags;
+            Slot* slots;
+            usize mask;
+        };
+
+        std::filesystem::path _path;
+        FileMapping _mapping;
+        View _view;
+        HASH _hash;
+        EQUAL _equal;
+
+        [[nodiscard]] static constexpr auto get_slots_offset(usize capacity) noexcept -> usize {
+            const auto tags_end = header_size + capacity + group_size;
+            return (tags_end + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+        }
+
+        [[nodiscard]] static constexpr auto get_file_size(usize capacity) noexcept -> usize {
+            return get_slots_offset(capacity) + capacity * sizeof(Slot);
+        }
+
+        [[nodiscard]] static constexpr auto to_tag(u64 hash) noexcept -> u8 {
+            return static_cast<u8>(hash >> 57U) | 0x80U;// Occupied slots always have the top bit set
+        }
+
+        [[nodiscard]] static inline auto make_view(FileMapping& mapping) noexcept -> View {
+            auto* address = static_cast<u8*>(mapping.get_address());
+            auto* header = reinterpret_cast<MappedHashTableHeader*>(address);// NOLINT
+            const auto capacity = static_cast<usize>(header->capacity);
+            auto* slots = reinterpret_cast<Slot*>(address + get_slots_offset(capacity));// NOLINT
+            return {header, address + header_size, slots, capacity - 1};
+        }
+
+        // Returns a bit for every slot of the group whose tag matches, and one for every empty slot
+        [[nodiscard]] static inline auto match_group(const u8* tags, u8 tag) noexcept -> std::pair<u32, u32> {
+#ifdef KSTD_MAPPED_HASH_TABLE_SSE2
+            const auto group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tags));// NOLINT
+            const auto matches = _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(tag))));
+            const auto empties = _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_setzero_si128()));
+            return {static_cast<u32>(matches), static_cast<u32>(empties)};
+#else
+            u32 matches = 0;
+            u32 empties = 0;
+
+            for(usize index = 0; index < group_size; ++index) {
+                matches |= static_cast<u32>(tags[index] == tag) << index;      // NOLINT
+                empties |= static_cast<u32>(tags[index] == empty_tag) << index;// NOLINT
+            }
+
+            return {matches, empties};
+#endif
+        }
+
+        [[nodiscard]] static inline auto count_trailing_zeros(u32 value) noexcept -> usize {
+            usize count = 0;
+
+            while((value & 1U) == 0) {
+                value >>= 1U;
+                ++count;
+            }
+
+            return count;
+        }
+
+        static inline auto set_tag(View& view, usize index, u8 tag) noexcept -> void {
+            view.tags[index] = tag;// NOLINT
+
+            // The first group is mirrored past the end, so groups can be loaded across the wrap-around
+            if(index < group_size) {
+                view.tags[view.mask + 1 + index] = tag;// NOLINT
+            }
+        }
+
+        [[nodiscard]] inline auto find_slot(const View& view, const K& key) const noexcept -> Slot* {
+            const auto hash = _hash(key);
+            const auto tag = to_tag(hash);
+            const auto capacity = view.mask + 1;
+            const auto home = static_cast<usize>(hash) & view.mask;
+
+            for(usize probed = 0; probed < capacity; probed += group_size) {
+                const auto base = (home + probed) & view.mask;
+                auto [matches, empties] = match_group(view.tags + base, tag);// NOLINT
+
+                if(empties != 0) {
+                    matches &= (empties & (~empties + 1)) - 1;// Nothing past the first empty slot belongs to us
+                }
+
+                while(matches != 0) {
+                    auto& slot = view.slots[(base + count_trailing_zeros(matches)) & view.mask];// NOLINT
+
+                    if(_equal(slot.key, key)) {
+                        return &slot;
+                    }
+
+                    matches &= matches - 1;
+                }
+
+                if(empties != 0) {
+                    return nullptr;
+                }
+            }
+
+            return nullptr;
+        }
+
+        // Inserts a key which is known to be absent into a table which is known to have room for it
+        inline auto insert_new(View& view, const K& key, const V& value) const noexcept -> V* {
+            const auto hash = _hash(key);
+            auto index = static_cast<usize>(hash) & view.mask;
+
+            while(view.tags[index] != empty_tag) {// NOLINT
+                index = (index + 1) & view.mask;
+            }
+
+            set_tag(view, index, to_tag(hash));
+            view.slots[index] = Slot {key, value};// NOLINT
+            ++view.header->size;
+            return &view.slots[index].value;// NOLINT
+        }
+
+        [[nodiscard]] static inline auto create_file(const std::filesystem::path& path, usize capacity) noexcept
+                -> Result<FileMapping> {
+            auto mapping = try_construct<FileMapping>(path, MappingAccess::READ | MappingAccess::WRITE);
+
+            if(!mapping) {
+                return mapping;
+            }
+
+            if(auto result = mapping->resize(get_file_size(capacity)); !result) {
+                return result.forward<FileMapping>();
+            }
+
+            // A zero tag marks a slot as empty, the slots themselves don't need clearing
+            std::memset(mapping->get_address(), 0, header_size + capacity + group_size);
+            *static_cast<MappedHashTableHeader*>(mapping->get_address()) = {
+                    MappedHashTableHeader::magic_value,
+                    MappedHashTableHeader::current_version,
+                    static_cast<u32>(sizeof(K)),
+                    static_cast<u32>(sizeof(V)),
+                    static_cast<u32>(sizeof(Slot)),
+                    static_cast<u64>(capacity),
+                    0};
+            return mapping;
+        }
+
+        [[nodiscard]] static inline auto get_rehash_path(const std::filesystem::path& path) -> std::filesystem::path {
+            auto rehash_path = path;
+            rehash_path += ".rehash";
+            return rehash_path;
+        }
+
+        [[nodiscard]] inline auto rehash(usize capacity) noexcept -> Result<void> {
+            const auto rehash_path = get_rehash_path(_path);
+
+            {
+                auto mapping = create_file(rehash_path, capacity);
+
+                if(!mapping) {
+                    return mapping.forward<void>();
+                }
+
+                auto view = make_view(*mapping);
+
+                for(usize index = 0; index <= _view.mask; ++index) {
+                    if(_view.tags[index] != empty_tag) {// NOLINT
+                        insert_new(view, _view.slots[index].key, _view.slots[index].value);// NOLINT
+                    }
+                }
+
+                if(auto result = mapping->sync(); !result) {
+                    return result;
+                }
+            }
+
+            // Windows can't replace a file which is still mapped, so let go of it first
+            _mapping = FileMapping {};
+            std::error_code error {};
+            std::filesystem::rename(rehash_path, _path, error);
+            auto mapping = try_construct<FileMapping>(_path, MappingAccess::READ | MappingAccess::WRITE);
+
+            if(!mapping) {
+                return mapping.forward<void>();
+            }
+
+            _mapping = std::move(*mapping);
+            _view = make_view(_mapping);
+
+            if(error) {
+                return Error {fmt::format("Could not replace hash table {}: {}", _path.string(), error.message())};
+            }
+
+            return {};
+        }
+
+        public:
+        /**
+         * Opens the table stored in the given file, or creates it with room
+         * for the given number of slots if the file is empty.
+         */
+        explicit MappedHashTable(std::filesystem::path path, usize initial_capacity = min_capacity,
+                                 HASH hash = HASH {}, EQUAL equal = EQUAL {}) :
+                _path {std::move(path)},
+                _view {},
+                _hash {std::move(hash)},
+                _equal {std::move(equal)} {
+            // A leftover of a resize which crashed midway, the original is still intact
+            std::error_code error {};
+            std::filesystem::remove(get_rehash_path(_path), error);
+
+            _mapping = FileMapping {_path, MappingAccess::READ | MappingAccess::WRITE};
+
+            if(_mapping.get_size() < header_size) {
+                auto capacity = min_capacity;
+
+                while(capacity < initial_capacity) {
+                    capacity <<= 1U;
+                }
+
+                _mapping = create_file(_path, capacity).get_or_throw();
+            }
+
+            const auto& header = *static_cast<MappedHashTableHeader*>(_mapping.get_address());
+            const auto is_valid = header.magic == MappedHashTableHeader::magic_value &&
+                                  header.version == MappedHashTableHeader::current_version;
+
+            if(!is_valid) {
+                throw std::runtime_error {fmt::format("Could not open hash table {}: invalid header", _path.string())};
+            }
+
+            if(header.key_size != sizeof(K) || header.value_size != sizeof(V) || header.slot_size != sizeof(Slot)) {
+                throw std::runtime_error {fmt::format("Could not open hash table {}: mismatching key or value type",
+                                                      _path.string())};
+            }
+
+            const auto capacity = static_cast<usize>(header.capacity);
+            const auto is_power_of_two = capacity >= min_capacity && (capacity & (capacity - 1)) == 0;
+
+            if(!is_power_of_two || _mapping.get_size() < get_file_size(capacity) || header.size > capacity) {
+                throw std::runtime_error {
+                        fmt::format("Could not open hash table {}: corrupted layout", _path.string())};
+            }
+
+            _view = make_view(_mapping);
+        }
+
+        ~MappedHashTable() noexcept = default;
+
+        KSTD_DEFAULT_MOVE(MappedHashTable, MappedHashTable)
+        KSTD_NO_COPY(MappedHashTable, MappedHashTable)
+
+        [[nodiscard]] inline auto find(const K& key) noexcept -> V* {
+            auto* slot = find_slot(_view, key);
+            return slot == nullptr ? nullptr : &slot->value;
+        }
+
+        [[nodiscard]] inline auto find(const K& key) const noexcept -> const V* {
+            const auto* slot = find_slot(_view, key);
+            return slot == nullptr ? nullptr : &slot->value;
+        }
+
+        [[nodiscard]] inline auto contains(const K& key) const noexcept -> bool {
+            return find_slot(_view, key) != nullptr;
+        }
+
+        /**
+         * Inserts or replaces the value of the given key,
+         * growing the table beforehand if it would exceed 3/4 of its capacity.
+         */
+        [[nodiscard]] inline auto insert(const K& key, const V& value) noexcept -> Result<V*> {
+            if(auto* slot = find_slot(_view, key); slot != nullptr) {
+                slot->value = value;
+                return &slot->value;
+            }
+
+            if(auto result = reserve(get_size() + 1); !result) {
+                return result.template forward<V*>();
+            }
+
+            return insert_new(_view, key, value);
+        }
+
+        /**
+         * Removes the given key, shifting back the entries which probed past it,
+         * so lookups never have to skip over tombstones.
+         */
+        inline auto erase(const K& key) noexcept -> bool {
+            auto* slot = find_slot(_view, key);
+
+            if(slot == nullptr) {
+                return false;
+            }
+
+            auto hole = static_cast<usize>(slot - _view.slots);
+            auto index = hole;
+
+            while(true) {
+                index = (index + 1) & _view.mask;
+
+                if(_view.tags[index] == empty_tag) {// NOLINT
+                    break;
+                }
+
+                // Entries whose home lies cyclically within (hole, index] have to stay where they are
+                const auto home = static_cast<usize>(_hash(_view.slots[index].key)) & _view.mask;// NOLINT
+                const auto distance_to_home = (index - home) & _view.mask;
+                const auto distance_to_hole = (index - hole) & _view.mask;
+
+                if(distance_to_home >= distance_to_hole) {
+                    _view.slots[hole] = _view.slots[index];  // NOLINT
+                    set_tag(_view, hole, _view.tags[index]);// NOLINT
+                    hole = index;
+                }
+            }
+
+            set_tag(_view, hole, empty_tag);
+            --_view.header->size;
+            return true;
+        }
+
+        [[nodiscard]] inline auto reserve(usize count) noexcept -> Result<void> {
+            auto capacity = get_capacity();
+
+            while(count > capacity - (capacity >> 2U)) {
+                capacity <<= 1U;
+            }
+
+            if(capacity == get_capacity()) {
+                return {};
+            }
+
+            return rehash(capacity);
+        }
+
+        template<typename F>
+        inline auto for_each(F&& function) const noexcept(std::is_nothrow_invocable_v<F, const K&, const V&>) -> void {
+            for(usize index = 0; index <= _view.mask; ++index) {
+                if(_view.tags[index] != empty_tag) {// NOLINT
+                    function(_view.slots[index].key, _view.slots[index].value);// NOLINT
+                }
+            }
+        }
+
+        inline auto clear() noexcept -> void {
+            std::memset(_view.tags, empty_tag, get_capacity() + group_size);
+            _view.header->size = 0;
+        }
+
+        [[nodiscard]] inline auto sync(SyncFlags flags = SyncFlags::NONE) noexcept -> Result<void> {
+            return _mapping.sync({0, _mapping.get_size()}, flags);
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return static_cast<usize>(_view.header->size);
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _view.mask + 1;
+        }
+
+        [[nodiscard]] inline auto get_load_factor() const noexcept -> f64 {
+            return static_cast<f64>(get_size()) / static_cast<f64>(get_capacity());
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return get_size() == 0;
+        }
+
+        [[nodiscard]] inline auto get_path() const noexcept -> const std::filesystem::path& {
+            return _path;
+        }
+
+        [[nodiscard]] inline auto get_mapping() noexcept -> FileMapping& {
+            return _mapping;
+        }
+    };
+}// namespace kstd::platform::mm
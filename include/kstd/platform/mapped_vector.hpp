@@ -0,0 +1,313 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "file_mapping.hpp"
+#include "virtual_arena.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace kstd::platform::mm {
+    struct MappedVectorHeader final {
+        static constexpr u64 magic_value = 0x524F5443'4556444DULL;// "MDVECTOR"
+        static constexpr u32 current_version = 1;
+
+        u64 magic;
+        u32 version;
+        u32 element_size;
+        u64 size;
+    };
+
+    /**
+     * A vector of trivially copyable elements which lives in a mapping and never copies
+     * its contents when it grows. Anonymous vectors reserve address space for their maximum
+     * size up front and commit it as they grow, so their elements never move.
+     * Persistent vectors store a small header and their elements in a file and grow it
+     * through remapping, so they can be reopened right away. Their elements move
+     * whenever the file is remapped.
+     */
+    template<typename T>
+    class MappedVector final {
+        static_assert(std::is_trivially_copyable_v<T>, "Mapped vectors can only hold trivially copyable types");
+
+        static constexpr usize header_size = (sizeof(MappedVectorHeader) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+        VirtualArena _arena;
+        FileMapping _mapping;
+        T* _data;
+        usize _size;
+        usize _capacity;
+        bool _is_persistent;
+
+        [[nodiscard]] inline auto get_header() noexcept -> MappedVectorHeader* {
+            return static_cast<MappedVectorHeader*>(_mapping.get_address());
+        }
+
+        inline auto bind_file() noexcept -> void {
+            auto* address = static_cast<u8*>(_mapping.get_address());
+            _data = reinterpret_cast<T*>(address + header_size);// NOLINT
+            _capacity = (_mapping.get_size() - header_size) / sizeof(T);
+        }
+
+        inline auto set_size(usize size) noexcept -> void {
+            _size = size;
+
+            if(_is_persistent) {
+                get_header()->size = size;
+            }
+        }
+
+        public:
+        static constexpr usize default_max_size = static_cast<usize>(1U) << 36U;
+
+        MappedVector(MappedVector&& other) noexcept :
+                _arena {std::move(other._arena)},
+                _mapping {std::move(other._mapping)},
+                _data {other._data},
+                _size {other._size},
+                _capacity {other._capacity},
+                _is_persistent {other._is_persistent} {
+            other._data = nullptr;
+            other._size = 0;
+            other._capacity = 0;
+        }
+
+        /**
+         * Creates an anonymous vector which reserves address space
+         * for up to max_size bytes of elements.
+         */
+        explicit MappedVector(usize max_size = default_max_size) :
+                _arena {max_size},
+                _data {static_cast<T*>(_arena.get_address())},
+                _size {0},
+                _capacity {0},
+                _is_persistent {false} {
+        }
+
+        /**
+         * Opens the vector persisted in the given file, or creates it if the file is empty.
+         */
+        explicit MappedVector(std::filesystem::path path, MappingFlags flags = MappingFlags::NONE) :
+                _mapping {std::move(path), MappingAccess::READ | MappingAccess::WRITE, flags},
+                _data {nullptr},
+                _size {0},
+                _capacity {0},
+                _is_persistent {true} {
+            if(_mapping.get_size() < header_size) {
+                _mapping.resize(header_size + get_page_size()).throw_if_error();
+                *get_header() = {MappedVectorHeader::magic_value, MappedVectorHeader::current_version, sizeof(T), 0};
+            }
+
+            const auto& header = *get_header();
+            const auto file_path = _mapping.get_file().get_path().string();
+
+            const auto is_valid = header.magic == MappedVectorHeader::magic_value &&
+                                  header.version == MappedVectorHeader::current_version;
+
+            if(!is_valid) {
+                throw std::runtime_error {fmt::format("Could not open mapped vector {}: invalid header", file_path)};
+            }
+
+            if(header.element_size != sizeof(T)) {
+                throw std::runtime_error {fmt::format("Could not open mapped vector {}: holds {} byte elements",
+                                                      file_path, header.element_size)};
+            }
+
+            bind_file();
+
+            if(header.size > _capacity) {
+                throw std::runtime_error {fmt::format("Could not open mapped vector {}: file is truncated", file_path)};
+            }
+
+            _size = static_cast<usize>(header.size);
+        }
+
+        ~MappedVector() noexcept = default;
+
+        auto operator=(MappedVector&& other) noexcept -> MappedVector& {
+            if(this == &other) {
+                return *this;
+            }
+
+            _arena = std::move(other._arena);
+            _mapping = std::move(other._mapping);
+            _data = other._data;
+            _size = other._size;
+            _capacity = other._capacity;
+            _is_persistent = other._is_persistent;
+            other._data = nullptr;
+            other._size = 0;
+            other._capacity = 0;
+            return *this;
+        }
+
+        KSTD_NO_COPY(MappedVector, MappedVector)
+
+        /**
+         * Makes room for at least capacity elements. Persistent vectors at least
+         * double their file, anonymous ones commit just what they need.
+         */
+        [[nodiscard]] inline auto reserve(usize capacity) noexcept -> Result<void> {
+            if(capacity <= _capacity) {
+                return {};
+            }
+
+            if(_is_persistent) {
+                const auto new_capacity = std::max(capacity, _capacity << 1U);
+
+                if(auto result = _mapping.resize(header_size + new_capacity * sizeof(T)); !result) {
+                    return result;
+                }
+
+                bind_file();
+                return {};
+            }
+
+            if(capacity > _arena.get_size() / sizeof(T)) {
+                return Error {fmt::format("Could not reserve {} elements: exceeds reserved size of {} bytes", capacity,
+                                          _arena.get_size())};
+            }
+
+            auto result = _arena.allocate((capacity - _capacity) * sizeof(T), 1);
+
+            if(!result) {
+                return result.forward<void>();
+            }
+
+            _capacity = capacity;
+            return {};
+        }
+
+        [[nodiscard]] inline auto resize(usize size) noexcept -> Result<void> {
+            if(auto result = reserve(size); !result) {
+                return result;
+            }
+
+            if(size > _size) {
+                std::uninitialized_value_construct(_data + _size, _data + size);// NOLINT
+            }
+
+            set_size(size);
+            return {};
+        }
+
+        [[nodiscard]] inline auto push_back(const T& value) noexcept -> Result<void> {
+            return emplace_back(value);
+        }
+
+        template<typename... ARGS>
+        [[nodiscard]] inline auto emplace_back(ARGS&&... args) noexcept -> Result<void> {
+            if(_size == _capacity) {
+                if(auto result = reserve(_size + 1); !result) {
+                    return result;
+                }
+            }
+
+            new(_data + _size) T {std::forward<ARGS>(args)...};// NOLINT
+            set_size(_size + 1);
+            return {};
+        }
+
+        inline auto pop_back() noexcept -> void {
+            if(_size > 0) {
+                set_size(_size - 1);
+            }
+        }
+
+        inline auto clear() noexcept -> void {
+            set_size(0);
+        }
+
+        /**
+         * Writes the header and all elements back to the file, a no-op for anonymous vectors.
+         */
+        [[nodiscard]] inline auto sync(SyncFlags flags = SyncFlags::NONE) noexcept -> Result<void> {
+            if(!_is_persistent) {
+                return {};
+            }
+
+            return _mapping.sync({0, header_size + _size * sizeof(T)}, flags);
+        }
+
+        [[nodiscard]] inline auto operator[](usize index) noexcept -> T& {
+            return _data[index];// NOLINT
+        }
+
+        [[nodiscard]] inline auto operator[](usize index) const noexcept -> const T& {
+            return _data[index];// NOLINT
+        }
+
+        [[nodiscard]] inline auto begin() noexcept -> T* {
+            return _data;
+        }
+
+        [[nodiscard]] inline auto end() noexcept -> T* {
+            return _data + _size;// NOLINT
+        }
+
+        [[nodiscard]] inline auto begin() const noexcept -> const T* {
+            return _data;
+        }
+
+        [[nodiscard]] inline auto end() const noexcept -> const T* {
+            return _data + _size;// NOLINT
+        }
+
+        [[nodiscard]] inline auto get_data() noexcept -> T* {
+            return _data;
+        }
+
+        [[nodiscard]] inline auto get_data() const noexcept -> const T* {
+            return _data;
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _capacity;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        [[nodiscard]] inline auto is_persistent() const noexcept -> bool {
+            return _is_persistent;
+        }
+
+        [[nodiscard]] inline auto get_mapping() noexcept -> MemoryMapping& {
+            if(_is_persistent) {
+                return _mapping;
+            }
+
+            return _arena;
+        }
+    };
+}// namespace kstd::platform::mm
@@ -0,0 +1,233 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "file_mapping.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/safe_alloc.hpp>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace kstd::platform::mm {
+    struct MappingStatistics final {
+        std::filesystem::path path;
+        file::FileIdentity identity;
+        usize mapping_count;
+        usize mapped_bytes;
+    };
+
+    /**
+     * Hands out shared file mappings, so that every subsystem mapping the same
+     * file with the same access and size reuses one mapping instead of opening
+     * and mapping the file again. Mappings are released with their last user.
+     */
+    class MappingRegistry final {
+        struct Key final {
+            file::FileIdentity identity;
+            MappingAccess access;
+            MappingFlags flags;
+            usize size;
+
+            [[nodiscard]] inline auto operator==(const Key& other) const noexcept -> bool {
+                return identity == other.identity && access == other.access && flags == other.flags &&
+                       size == other.size;
+            }
+        };
+
+        struct KeyHash final {
+            [[nodiscard]] inline auto operator()(const Key& key) const noexcept -> usize {
+                auto hash = std::hash<u64> {}(key.identity.device);
+                hash = hash * 31 + std::hash<u64> {}(key.identity.inode);
+                hash = hash * 31 + static_cast<usize>(key.access);
+                hash = hash * 31 + static_cast<usize>(key.flags);
+                return hash * 31 + std::hash<usize> {}(key.size);
+            }
+        };
+
+        struct Entry final {
+            std::filesystem::path path;
+            std::weak_ptr<FileMapping> mapping;
+        };
+
+        std::unordered_map<Key, Entry, KeyHash> _entries;
+        mutable std::mutex _mutex;
+
+        inline auto purge_expired() noexcept -> void {
+            for(auto iterator = _entries.begin(); iterator != _entries.end();) {
+                if(iterator->second.mapping.expired()) {
+                    iterator = _entries.erase(iterator);
+                    continue;
+                }
+
+                ++iterator;
+            }
+        }
+
+        [[nodiscard]] static inline auto make_shared_mapping(FileMapping mapping) noexcept
+                -> Result<std::shared_ptr<FileMapping>> {
+            try {
+                return std::make_shared<FileMapping>(std::move(mapping));
+            }
+            catch(const std::bad_alloc&) {
+                return Error {std::string("Could not acquire mapping: out of memory")};
+            }
+        }
+
+        public:
+        KSTD_NO_COPY(MappingRegistry, MappingRegistry)
+
+        MappingRegistry() noexcept = default;
+        ~MappingRegistry() noexcept = default;
+
+        [[nodiscard]] static inline auto get_global() noexcept -> MappingRegistry& {
+            static MappingRegistry s_registry {};
+            return s_registry;
+        }
+
+        /**
+         * Returns the existing mapping of the given file if it is mapped with the
+         * same access, flags and size already, otherwise creates a new one.
+         * Mappings always span the whole file. MappingFlags::PRIVATE mappings
+         * are never shared, every call creates a new one.
+         * The mapping is shared with every other user of the file, so it must
+         * never be resized, reassigned or have its write tracking toggled;
+         * reading, writing and syncing its contents is fine.
+         */
+        [[nodiscard]] inline auto acquire(const std::filesystem::path& path, MappingAccess access,
+                                          MappingFlags flags = MappingFlags::NONE) noexcept
+                -> Result<std::shared_ptr<FileMapping>> {
+            // Private mappings must never see each other's writes, so every caller gets its own
+            if((flags & MappingFlags::PRIVATE) == MappingFlags::PRIVATE) {
+                auto mapping_result = try_construct<FileMapping>(path, access, flags);
+
+                if(!mapping_result) {
+                    return mapping_result.forward<std::shared_ptr<FileMapping>>();
+                }
+
+                return make_shared_mapping(std::move(*mapping_result));
+            }
+
+            auto file_result = try_construct<file::File>(path, derive_file_mode(access, flags));
+
+            if(!file_result) {
+                return file_result.forward<std::shared_ptr<FileMapping>>();
+            }
+
+            auto identity_result = file_result->get_identity();
+
+            if(!identity_result) {
+                return identity_result.forward<std::shared_ptr<FileMapping>>();
+            }
+
+            const auto size = std::max<usize>(file_result->get_size().get_or(0), 1);
+            const auto key = Key {*identity_result, access, flags, size};
+            const std::lock_guard lock {_mutex};
+
+            if(const auto iterator = _entries.find(key); iterator != _entries.end()) {
+                if(auto mapping = iterator->second.mapping.lock()) {
+                    return mapping;
+                }
+            }
+
+            auto mapping_result = try_construct<FileMapping>(path, access, flags);
+
+            if(!mapping_result) {
+                return mapping_result.forward<std::shared_ptr<FileMapping>>();
+            }
+
+            auto mapping = make_shared_mapping(std::move(*mapping_result));
+
+            if(!mapping) {
+                return mapping;
+            }
+
+            purge_expired();
+
+            try {
+                _entries[key] = Entry {path, *mapping};
+            }
+            catch(const std::bad_alloc&) {
+                // The mapping still works, it just isn't shared with later callers
+            }
+
+            return mapping;
+        }
+
+        /**
+         * Returns the number of live mappings and the total number of
+         * mapped bytes for every file which is currently mapped.
+         */
+        [[nodiscard]] inline auto get_statistics() const noexcept -> std::vector<MappingStatistics> {
+            std::vector<MappingStatistics> statistics {};
+            const std::lock_guard lock {_mutex};
+
+            for(const auto& [key, entry] : _entries) {
+                const auto mapping = entry.mapping.lock();
+
+                if(mapping == nullptr) {
+                    continue;
+                }
+
+                auto iterator = std::find_if(statistics.begin(), statistics.end(), [&key = key](const auto& value) {
+                    return value.identity == key.identity;
+                });
+
+                if(iterator == statistics.end()) {
+                    statistics.push_back({entry.path, key.identity, 0, 0});
+                    iterator = statistics.end() - 1;
+                }
+
+                ++iterator->mapping_count;
+                iterator->mapped_bytes += mapping->get_size();
+            }
+
+            return statistics;
+        }
+
+        [[nodiscard]] inline auto get_mapped_bytes(const file::FileIdentity& identity) const noexcept -> usize {
+            usize mapped_bytes = 0;
+
+            for(const auto& statistics : get_statistics()) {
+                if(statistics.identity == identity) {
+                    mapped_bytes += statistics.mapped_bytes;
+                }
+            }
+
+            return mapped_bytes;
+        }
+
+        [[nodiscard]] inline auto get_total_mapped_bytes() const noexcept -> usize {
+            usize mapped_bytes = 0;
+
+            for(const auto& statistics : get_statistics()) {
+                mapped_bytes += statistics.mapped_bytes;
+            }
+
+            return mapped_bytes;
+        }
+    };
+}// namespace kstd::platform::mm
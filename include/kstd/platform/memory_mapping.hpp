@@ -20,30 +20,87 @@
 #pragma once
 
 #include "file.hpp"
+#include "mapped_array.hpp"
+#include "numa.hpp"
+#include "page_residency.hpp"
 #include <kstd/bitflags.hpp>
 #include <kstd/defaults.hpp>
 #include <kstd/result.hpp>
 #include <kstd/types.hpp>
+#include <type_traits>
+#include <vector>
 
 namespace kstd::platform::mm {
     enum class MappingType : u8 {
-        FILE
+        FILE,
+        RING,
+        SHARED,
+        ARENA,
+        LAZY
+    };
+
+    enum class MappingAdvice : u8 {
+        NORMAL,
+        SEQUENTIAL,
+        RANDOM,
+        WILL_NEED,
+        DONT_NEED,
+        COLD,
+        PAGE_OUT,
+        POPULATE_READ,
+        POPULATE_WRITE
     };
 
     KSTD_BITFLAGS(u8, MappingAccess, READ = 0x01U, WRITE = 0x02U, EXECUTE = 0x04U)// NOLINT
 
-    [[nodiscard]] inline auto derive_file_mode(MappingAccess access) noexcept -> file::FileMode {
+    KSTD_BITFLAGS(u8, MappingFlags, POPULATE = 0x01U, PRIVATE = 0x02U)// NOLINT
+
+    KSTD_BITFLAGS(u8, SyncFlags, ASYNC = 0x01U, INVALIDATE = 0x02U)// NOLINT
+
+    KSTD_BITFLAGS(u8, LockFlags, ON_FAULT = 0x01U)// NOLINT
+
+    KSTD_BITFLAGS(u8, ProcessLockFlags, CURRENT = 0x01U, FUTURE = 0x02U, ON_FAULT = 0x04U)// NOLINT
+
+    struct MappingRange final {
+        usize offset;
+        usize size;
+
+        [[nodiscard]] constexpr auto get_end() const noexcept -> usize {
+            return offset + size;
+        }
+
+        [[nodiscard]] constexpr auto is_within(usize mapping_size) const noexcept -> bool {
+            return offset <= mapping_size && size <= mapping_size - offset;
+        }
+
+        [[nodiscard]] constexpr auto align_to(usize alignment) const noexcept -> MappingRange {
+            const auto begin = offset - (offset % alignment);
+            const auto end = ((get_end() + alignment - 1) / alignment) * alignment;
+            return {begin, end - begin};
+        }
+
+        // Returns the whole pages inside the range, the end of the mapping counts as aligned
+        [[nodiscard]] constexpr auto shrink_to(usize alignment, usize mapping_size) const noexcept -> MappingRange {
+            const auto begin = ((offset + alignment - 1) / alignment) * alignment;
+            const auto end = get_end() == mapping_size ? get_end() : get_end() - (get_end() % alignment);
+            return {begin, end > begin ? end - begin : 0};
+        }
+    };
+
+    [[nodiscard]] inline auto derive_file_mode(MappingAccess access, MappingFlags flags = MappingFlags::NONE) noexcept
+            -> file::FileMode {
         const auto is_readable = (access & MappingAccess::READ) == MappingAccess::READ;
-        const auto is_writable = (access & MappingAccess::WRITE) == MappingAccess::WRITE;
+        const auto is_private = (flags & MappingFlags::PRIVATE) == MappingFlags::PRIVATE;
+        const auto is_writable = (access & MappingAccess::WRITE) == MappingAccess::WRITE && !is_private;
 
         if(is_readable && is_writable) {
             return file::FileMode::READ_WRITE;
         }
         else if(is_writable) {// NOLINT
-            return file::FileMode::READ;
+            return file::FileMode::WRITE;
         }
 
-        return file::FileMode::WRITE;
+        return file::FileMode::READ;
     }
 
     [[nodiscard]] inline auto derive_access(file::FileMode mode) noexcept -> MappingAccess {
@@ -54,15 +111,162 @@ namespace kstd::platform::mm {
         }
     }
 
+    /**
+     * Returns how many bytes of memory the process may lock, which is the RLIMIT_MEMLOCK
+     * on POSIX and the minimum working set size on Windows. No limit is reported as
+     * the maximum value of usize.
+     */
+    [[nodiscard]] auto get_lock_limit() noexcept -> Result<usize>;
+
+    /**
+     * Locks all memory mapped by the process now and/or in the future, after checking
+     * the current mappings against the lock limit. ProcessLockFlags::ON_FAULT only
+     * locks pages once they are faulted in. Only supported on Linux.
+     */
+    [[nodiscard]] auto lock_process_memory(ProcessLockFlags flags = ProcessLockFlags::CURRENT |
+                                                                   ProcessLockFlags::FUTURE) noexcept -> Result<void>;
+
+    [[nodiscard]] auto unlock_process_memory() noexcept -> Result<void>;
+
     struct MemoryMapping {
+        virtual ~MemoryMapping() noexcept = default;
+
         [[nodiscard]] virtual auto resize(usize size) noexcept -> Result<void> = 0;
 
         [[nodiscard]] virtual auto sync() noexcept -> Result<void> = 0;
 
+        [[nodiscard]] virtual auto sync(MappingRange range, SyncFlags flags = SyncFlags::NONE) noexcept -> Result<void>;
+
         [[nodiscard]] virtual auto get_type() const noexcept -> MappingType = 0;
 
         [[nodiscard]] virtual auto get_access() const noexcept -> MappingAccess = 0;
 
         [[nodiscard]] virtual auto get_address() const noexcept -> void* = 0;
+
+        [[nodiscard]] virtual auto get_size() const noexcept -> usize = 0;
+
+        /**
+         * Passes the given advice for the pages spanned by the range to the OS.
+         * DONT_NEED, COLD and PAGE_OUT may drop the contents of private pages,
+         * so they only apply to the whole pages inside of the range instead.
+         */
+        [[nodiscard]] virtual auto advise(MappingRange range, MappingAdvice advice) noexcept -> Result<void>;
+
+        /**
+         * Changes the access of the pages spanned by the given range,
+         * MappingAccess::NONE makes them inaccessible, e.g. for guard pages.
+         */
+        [[nodiscard]] virtual auto protect(MappingRange range, MappingAccess access) noexcept -> Result<void>;
+
+        /**
+         * Keeps the pages spanned by the given range resident, so accessing them never
+         * causes a major fault. LockFlags::ON_FAULT locks pages as they are faulted in
+         * instead of populating the whole range up front, where the OS supports it.
+         * Fails before locking anything if the range doesn't fit into the lock limit.
+         */
+        [[nodiscard]] virtual auto lock(MappingRange range, LockFlags flags = LockFlags::NONE) noexcept -> Result<void>;
+
+        [[nodiscard]] virtual auto unlock(MappingRange range) noexcept -> Result<void>;
+
+        /**
+         * Returns the number of pages of the mapping which were copied into
+         * private memory on their first write, which is the memory cost of
+         * changes to a MappingFlags::PRIVATE mapping.
+         */
+        [[nodiscard]] virtual auto get_private_page_count() const noexcept -> Result<usize>;
+
+        /**
+         * Returns which pages of the given range are resident in physical memory.
+         * The range is widened to page boundaries, bit 0 being the page containing its offset.
+         */
+        [[nodiscard]] virtual auto get_residency(MappingRange range) const noexcept -> Result<PageResidency>;
+
+        [[nodiscard]] inline auto get_residency() const noexcept -> Result<PageResidency> {
+            return get_residency({0, get_size()});
+        }
+
+        /**
+         * Sets the NUMA policy for pages of the given range faulted in from now on.
+         * When move_existing is set, pages already placed elsewhere are migrated.
+         */
+        [[nodiscard]] virtual auto set_numa_policy(MappingRange range, NumaPolicy policy,
+                                                   const std::vector<u32>& nodes = {},
+                                                   bool move_existing = false) noexcept -> Result<void>;
+
+        /**
+         * Returns the NUMA node of every page in the given range, widened to page
+         * boundaries. Pages which are not resident are reported as -ENOENT.
+         */
+        [[nodiscard]] virtual auto get_numa_nodes(MappingRange range) const noexcept -> Result<std::vector<i32>>;
+
+        /**
+         * Returns a typed view of count elements starting at the given byte offset,
+         * or of all elements up to the end of the mapping if count is omitted.
+         * Non-const element types require the mapping to be writable.
+         */
+        template<typename T>
+        [[nodiscard]] auto as_array(usize offset = 0, usize count = static_cast<usize>(-1)) const noexcept
+                -> Result<MappedArray<T>> {
+            const auto size = get_size();
+
+            if(offset > size) {
+                return Error {fmt::format("Could not view mapping at {}: exceeds mapping size {}", offset, size)};
+            }
+
+            if(count == static_cast<usize>(-1)) {
+                count = (size - offset) / sizeof(T);
+            }
+
+            if(count > (size - offset) / sizeof(T)) {
+                return Error {fmt::format("Could not view {} elements of size {} at {}: exceeds mapping size {}",
+                                          count, sizeof(T), offset, size)};
+            }
+
+            if constexpr(!std::is_const_v<T>) {
+                if((get_access() & MappingAccess::WRITE) != MappingAccess::WRITE) {
+                    return Error {std::string("Could not create mutable view: mapping is not writable")};
+                }
+            }
+
+            auto* address = static_cast<u8*>(get_address()) + offset;// NOLINT
+
+            if(reinterpret_cast<uintptr_t>(address) % alignof(T) != 0) {// NOLINT
+                return Error {fmt::format("Could not view mapping at {}: misaligned for alignment {}", offset,
+                                          alignof(T))};
+            }
+
+            return MappedArray<T> {reinterpret_cast<T*>(address), count};// NOLINT
+        }
+
+        /**
+         * Returns a pointer to a single element at the given byte offset
+         * after validating its bounds and alignment.
+         */
+        template<typename T>
+        [[nodiscard]] auto view_at(usize offset) const noexcept -> Result<T*> {
+            auto array_result = as_array<T>(offset, 1);
+
+            if(!array_result) {
+                return array_result.template forward<T*>();
+            }
+
+            return array_result->get_data();
+        }
+
+#ifdef __cpp_lib_span
+
+        template<typename T>
+        [[nodiscard]] auto as_span(usize offset = 0, usize count = static_cast<usize>(-1)) const noexcept
+                -> Result<std::span<T>> {
+            auto array_result = as_array<T>(offset, count);
+
+            if(!array_result) {
+                return array_result.template forward<std::span<T>>();
+            }
+
+            return static_cast<std::span<T>>(*array_result);
+        }
+
+#endif
     };
 }// namespace kstd::platform::mm
\ No newline at end of file
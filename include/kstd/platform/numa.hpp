@@ -0,0 +1,81 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <vector>
+
+#include "platform.hpp"
+
+namespace kstd::platform {
+    enum class NumaPolicy : u8 {
+        DEFAULT,
+        LOCAL,
+        BIND,
+        PREFERRED,
+        INTERLEAVE
+    };
+
+    /**
+     * Returns one more than the highest online NUMA node, which is 1
+     * on machines or kernels without NUMA support.
+     */
+    [[nodiscard]] auto get_numa_node_count() noexcept -> usize;
+
+    /**
+     * Sets the policy for all future allocations of the calling thread.
+     * On single-node machines this only validates the arguments.
+     */
+    [[nodiscard]] auto set_thread_numa_policy(NumaPolicy policy, const std::vector<u32>& nodes = {}) noexcept
+            -> Result<void>;
+
+    [[nodiscard]] inline auto validate_numa_policy(NumaPolicy policy, const std::vector<u32>& nodes) noexcept
+            -> Result<void> {
+        const auto node_count = get_numa_node_count();
+
+        for(const auto node : nodes) {
+            if(node >= node_count) {
+                return Error {fmt::format("Could not apply NUMA policy: node {} does not exist", node)};
+            }
+        }
+
+        switch(policy) {
+            case NumaPolicy::DEFAULT:
+            case NumaPolicy::LOCAL:
+                if(!nodes.empty()) {
+                    return Error {std::string("Could not apply NUMA policy: default and local policies take no nodes")};
+                }
+                break;
+            case NumaPolicy::PREFERRED:
+                if(nodes.size() > 1) {
+                    return Error {std::string("Could not apply NUMA policy: preferred policy takes at most one node")};
+                }
+                break;
+            default:
+                if(nodes.empty()) {
+                    return Error {std::string("Could not apply NUMA policy: bind and interleave policies need nodes")};
+                }
+                break;
+        }
+
+        return {};
+    }
+}// namespace kstd::platform
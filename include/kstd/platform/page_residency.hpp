@@ -0,0 +1,94 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+#include <vector>
+
+namespace kstd::platform {
+    /**
+     * A snapshot of which pages of a range were resident in physical memory,
+     * as reported by mincore and its equivalents.
+     */
+    class PageResidency final {
+        static constexpr usize bits_per_word = sizeof(u64) << 3;
+
+        std::vector<u64> _words;
+        usize _page_size;
+        usize _page_count;
+        usize _resident_page_count;
+
+        public:
+        PageResidency() noexcept :
+                _page_size {0},
+                _page_count {0},
+                _resident_page_count {0} {
+        }
+
+        PageResidency(usize page_size, usize page_count) :
+                _words((page_count + bits_per_word - 1) / bits_per_word),
+                _page_size {page_size},
+                _page_count {page_count},
+                _resident_page_count {0} {
+        }
+
+        inline auto mark_resident(usize page) noexcept -> void {
+            auto& word = _words[page / bits_per_word];
+            const auto mask = u64 {1} << (page % bits_per_word);
+
+            if((word & mask) == 0) {
+                word |= mask;
+                ++_resident_page_count;
+            }
+        }
+
+        [[nodiscard]] inline auto is_resident(usize page) const noexcept -> bool {
+            return ((_words[page / bits_per_word] >> (page % bits_per_word)) & 1U) != 0;
+        }
+
+        [[nodiscard]] inline auto is_fully_resident() const noexcept -> bool {
+            return _resident_page_count == _page_count;
+        }
+
+        [[nodiscard]] inline auto get_resident_page_count() const noexcept -> usize {
+            return _resident_page_count;
+        }
+
+        [[nodiscard]] inline auto get_resident_size() const noexcept -> usize {
+            return _resident_page_count * _page_size;
+        }
+
+        [[nodiscard]] inline auto get_data() const noexcept -> const u64* {
+            return _words.data();
+        }
+
+        [[nodiscard]] inline auto get_word_count() const noexcept -> usize {
+            return _words.size();
+        }
+
+        [[nodiscard]] inline auto get_page_size() const noexcept -> usize {
+            return _page_size;
+        }
+
+        [[nodiscard]] inline auto get_page_count() const noexcept -> usize {
+            return _page_count;
+        }
+    };
+}// namespace kstd::platform
@@ -0,0 +1,175 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "memory_mapping.hpp"
+#include "platform.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace kstd::platform::mm {
+    struct PrefaultProgress final {
+        usize done_size;
+        usize total_size;
+        std::chrono::nanoseconds elapsed;
+
+        [[nodiscard]] constexpr auto get_ratio() const noexcept -> f64 {
+            return total_size == 0 ? 1.0 : static_cast<f64>(done_size) / static_cast<f64>(total_size);
+        }
+
+        // Returns the average number of bytes prefaulted per second so far
+        [[nodiscard]] constexpr auto get_throughput() const noexcept -> f64 {
+            const auto seconds = std::chrono::duration<f64>(elapsed).count();
+            return seconds == 0.0 ? 0.0 : static_cast<f64>(done_size) / seconds;
+        }
+    };
+
+    struct PrefaultOptions final {
+        usize thread_count = 0;            // Defaults to the number of hardware threads
+        usize chunk_size = 64 * 1024 * 1024;// Rounded up to the page size
+        usize max_bandwidth = 0;           // In bytes per second, zero means unlimited
+        MappingAdvice advice = MappingAdvice::POPULATE_READ;
+        std::chrono::milliseconds progress_interval {100};
+        std::function<void(const PrefaultProgress&)> on_progress {};
+    };
+
+    /**
+     * Faults in the pages of the given range with several threads at once, each of
+     * which populates chunks handed out in ascending order through MemoryMapping::advise.
+     * The bandwidth cap paces how fast chunks are handed out, so the rest of the process
+     * keeps some I/O to itself. Progress is reported from the calling thread, which
+     * blocks until all chunks are done or one of them failed.
+     */
+    [[nodiscard]] inline auto prefault(MemoryMapping& mapping, MappingRange range, const PrefaultOptions& options = {})
+            -> Result<PrefaultProgress> {
+        using Clock = std::chrono::steady_clock;
+
+        if(!range.is_within(mapping.get_size())) {
+            return Error {fmt::format("Could not prefault mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), mapping.get_size())};
+        }
+
+        const auto page_size = get_page_size();
+        const auto chunk_size = std::max((options.chunk_size + page_size - 1) / page_size * page_size, page_size);
+        const auto chunk_count = (range.size + chunk_size - 1) / chunk_size;
+        const auto hardware_threads = static_cast<usize>(std::max(std::thread::hardware_concurrency(), 1U));
+        const auto thread_count = std::min(options.thread_count == 0 ? hardware_threads : options.thread_count,
+                                           chunk_count);
+        const auto start = Clock::now();
+
+        std::atomic<usize> next_chunk {0};
+        std::atomic<usize> done_size {0};
+        std::atomic<usize> running_threads {thread_count};
+        std::atomic<bool> has_failed {false};
+        std::mutex error_mutex {};
+        std::optional<std::string> error {};
+
+        const auto populate = [&]() noexcept {
+            for(auto chunk = next_chunk.fetch_add(1, std::memory_order_relaxed); chunk < chunk_count;
+                chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+                if(has_failed.load(std::memory_order_relaxed)) {
+                    break;
+                }
+
+                const auto offset = chunk * chunk_size;
+
+                if(options.max_bandwidth != 0) {
+                    // Chunks are handed out in order, so the offset is all the bandwidth spent before this one
+                    const auto due = std::chrono::duration<f64>(static_cast<f64>(offset) /
+                                                                static_cast<f64>(options.max_bandwidth));
+                    std::this_thread::sleep_until(start + std::chrono::duration_cast<Clock::duration>(due));
+                }
+
+                const auto size = std::min(chunk_size, range.size - offset);
+
+                if(auto result = mapping.advise({range.offset + offset, size}, options.advice); !result) {
+                    const std::lock_guard lock {error_mutex};
+
+                    if(!error) {
+                        error = result.get_error();
+                    }
+
+                    has_failed.store(true, std::memory_order_relaxed);
+                    break;
+                }
+
+                done_size.fetch_add(size, std::memory_order_relaxed);
+            }
+
+            running_threads.fetch_sub(1, std::memory_order_release);
+        };
+
+        std::vector<std::thread> threads {};
+        threads.reserve(thread_count);
+
+        for(usize index = 0; index < thread_count; ++index) {
+            try {
+                threads.emplace_back(populate);
+            }
+            catch(const std::system_error& thread_error) {
+                // Stop the threads which already started, they must be joined before we return
+                has_failed.store(true, std::memory_order_relaxed);
+
+                for(auto& thread : threads) {
+                    thread.join();
+                }
+
+                return Error {fmt::format("Could not prefault mapping: could not start thread: {}",
+                                          thread_error.what())};
+            }
+        }
+
+        const auto get_progress = [&]() noexcept -> PrefaultProgress {
+            return {done_size.load(std::memory_order_relaxed), range.size, Clock::now() - start};
+        };
+
+        if(options.on_progress) {
+            while(running_threads.load(std::memory_order_acquire) != 0) {
+                std::this_thread::sleep_for(options.progress_interval);
+                options.on_progress(get_progress());
+            }
+        }
+
+        for(auto& thread : threads) {
+            thread.join();
+        }
+
+        if(error) {
+            return Error {*error};
+        }
+
+        return get_progress();
+    }
+
+    [[nodiscard]] inline auto prefault(MemoryMapping& mapping, const PrefaultOptions& options = {})
+            -> Result<PrefaultProgress> {
+        return prefault(mapping, {0, mapping.get_size()}, options);
+    }
+}// namespace kstd::platform::mm
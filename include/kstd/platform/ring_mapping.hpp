@@ -0,0 +1,160 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "file_handle.hpp"
+#include "memory_mapping.hpp"
+#include <atomic>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <thread>
+
+namespace kstd::platform::mm {
+    enum class RingMode : u8 {
+        SINGLE_PRODUCER,
+        MULTI_PRODUCER
+    };
+
+    struct RingRegion final {
+        u8* data;
+        usize size;
+        u64 position;
+
+        [[nodiscard]] constexpr auto is_valid() const noexcept -> bool {
+            return data != nullptr;
+        }
+    };
+
+    struct RingCursors final {
+        alignas(64) std::atomic<u64> reserve_head {0};
+        alignas(64) std::atomic<u64> commit_head {0};
+        alignas(64) std::atomic<u64> tail {0};
+    };
+
+    /**
+     * A ring buffer whose backing memory is mapped twice back-to-back, so that
+     * every region of up to get_size() bytes is contiguous in memory, even if it
+     * wraps around the end of the buffer. Any number of producers (depending on
+     * the mode) and a single consumer may use the ring concurrently.
+     */
+    class RingMapping final : public MemoryMapping {
+        RingMode _mode;
+        void* _address;
+        usize _size;
+        file::FileHandle _handle;
+        std::unique_ptr<RingCursors> _cursors;
+
+        public:
+        RingMapping(RingMapping&& other) noexcept;
+        RingMapping() noexcept;
+
+        explicit RingMapping(usize size, RingMode mode = RingMode::SINGLE_PRODUCER);
+
+        ~RingMapping() noexcept;
+
+        auto operator=(RingMapping&& other) noexcept -> RingMapping&;
+
+        KSTD_NO_COPY(RingMapping, RingMapping)
+
+        [[nodiscard]] auto resize(usize size) noexcept -> Result<void> final;
+
+        using MemoryMapping::sync;
+
+        [[nodiscard]] auto sync() noexcept -> Result<void> final;
+
+        [[nodiscard]] auto get_type() const noexcept -> MappingType final;
+
+        [[nodiscard]] auto get_access() const noexcept -> MappingAccess final;
+
+        [[nodiscard]] auto get_address() const noexcept -> void* final;
+
+        [[nodiscard]] auto get_size() const noexcept -> usize final;
+
+        /**
+         * Claims size contiguous bytes for writing. Returns an invalid
+         * region if the ring does not have enough free space.
+         */
+        [[nodiscard]] inline auto try_reserve(usize size) noexcept -> RingRegion {
+            auto head = _cursors->reserve_head.load(std::memory_order_relaxed);
+
+            while(true) {
+                const auto tail = _cursors->tail.load(std::memory_order_acquire);
+
+                if(size > _size - static_cast<usize>(head - tail)) {
+                    return {nullptr, 0, head};
+                }
+
+                if(_mode == RingMode::SINGLE_PRODUCER) {
+                    _cursors->reserve_head.store(head + size, std::memory_order_relaxed);
+                    break;
+                }
+
+                if(_cursors->reserve_head.compare_exchange_weak(head, head + size, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+
+            return {static_cast<u8*>(_address) + (head % _size), size, head};// NOLINT
+        }
+
+        /**
+         * Publishes a reserved region to the consumer. With multiple producers,
+         * regions become visible in the order they were reserved in.
+         */
+        inline auto commit(const RingRegion& region) noexcept -> void {
+            if(_mode == RingMode::MULTI_PRODUCER) {
+                while(_cursors->commit_head.load(std::memory_order_acquire) != region.position) {
+                    std::this_thread::yield();
+                }
+            }
+
+            _cursors->commit_head.store(region.position + region.size, std::memory_order_release);
+        }
+
+        /**
+         * Returns all bytes which were committed but not yet released as
+         * one contiguous region. May only be called by the consumer.
+         */
+        [[nodiscard]] inline auto peek() const noexcept -> RingRegion {
+            const auto tail = _cursors->tail.load(std::memory_order_relaxed);
+            const auto head = _cursors->commit_head.load(std::memory_order_acquire);
+            return {static_cast<u8*>(_address) + (tail % _size), static_cast<usize>(head - tail), tail};// NOLINT
+        }
+
+        /**
+         * Hands size bytes at the front of the ring back to the producers.
+         * May only be called by the consumer.
+         */
+        inline auto release(usize size) noexcept -> void {
+            const auto tail = _cursors->tail.load(std::memory_order_relaxed);
+            _cursors->tail.store(tail + size, std::memory_order_release);
+        }
+
+        [[nodiscard]] inline auto get_mode() const noexcept -> RingMode {
+            return _mode;
+        }
+
+        [[nodiscard]] inline auto get_handle() const noexcept -> file::FileHandle {
+            return _handle;
+        }
+    };
+}// namespace kstd::platform::mm
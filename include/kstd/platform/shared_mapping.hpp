@@ -0,0 +1,96 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "file_handle.hpp"
+#include "memory_mapping.hpp"
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <string>
+
+namespace kstd::platform::mm {
+    enum class SharedMode : u8 {
+        CREATE,
+        OPEN,
+        OPEN_OR_CREATE
+    };
+
+    /**
+     * A named region of memory which can be mapped by multiple processes.
+     * The process creating the region determines its size, processes opening
+     * it may pass a size of zero to adopt it, or a minimum size to validate.
+     * The creator removes the name again when its mapping is destroyed, while
+     * processes which already opened the region keep it alive.
+     */
+    class SharedMapping final : public MemoryMapping {
+        std::string _name;
+        MappingAccess _access;
+        void* _address;
+        usize _size;
+        file::FileHandle _handle;
+        bool _is_owner;
+
+        public:
+        SharedMapping(SharedMapping&& other) noexcept;
+        SharedMapping() noexcept;
+
+        SharedMapping(std::string name, MappingAccess access, SharedMode mode, usize size = 0);
+
+        /**
+         * Maps an existing shared memory handle, for example one which
+         * was received from another process. Takes ownership of the handle.
+         */
+        SharedMapping(file::FileHandle handle, MappingAccess access);
+
+        ~SharedMapping() noexcept;
+
+        auto operator=(SharedMapping&& other) noexcept -> SharedMapping&;
+
+        KSTD_NO_COPY(SharedMapping, SharedMapping)
+
+        [[nodiscard]] static auto unlink(const std::string& name) noexcept -> Result<void>;
+
+        [[nodiscard]] auto resize(usize size) noexcept -> Result<void> final;
+
+        using MemoryMapping::sync;
+
+        [[nodiscard]] auto sync() noexcept -> Result<void> final;
+
+        [[nodiscard]] auto get_type() const noexcept -> MappingType final;
+
+        [[nodiscard]] auto get_access() const noexcept -> MappingAccess final;
+
+        [[nodiscard]] auto get_address() const noexcept -> void* final;
+
+        [[nodiscard]] auto get_size() const noexcept -> usize final;
+
+        [[nodiscard]] inline auto get_name() const noexcept -> const std::string& {
+            return _name;
+        }
+
+        [[nodiscard]] inline auto get_handle() const noexcept -> file::FileHandle {
+            return _handle;
+        }
+
+        [[nodiscard]] inline auto is_owner() const noexcept -> bool {
+            return _is_owner;
+        }
+    };
+}// namespace kstd::platform::mm
@@ -0,0 +1,182 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "ring_mapping.hpp"
+#include "shared_mapping.hpp"
+#include <atomic>
+#include <cstring>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <new>
+#include <string>
+
+namespace kstd::platform::mm {
+    struct SharedQueueHeader final {
+        static constexpr u32 magic = 0x4B535155U;// KSQU
+        static constexpr u32 version = 1;
+
+        std::atomic<u32> header_magic;
+        u32 header_version;
+        u64 capacity;
+        alignas(64) std::atomic<u64> head;
+        alignas(64) std::atomic<u64> tail;
+    };
+
+    static_assert(std::atomic<u64>::is_always_lock_free, "Shared queues require lock-free 64-bit atomics");
+
+    /**
+     * A lock-free single-producer single-consumer queue of variable-sized messages
+     * inside of a SharedMapping. Messages are written and read in place, so two
+     * processes can exchange data without copying it through a socket.
+     */
+    class SharedQueue final {
+        static constexpr u64 padding_marker = ~u64 {0};
+        static constexpr usize message_alignment = alignof(u64);
+
+        SharedMapping _mapping;
+        SharedQueueHeader* _header;
+        u8* _data;
+        usize _capacity;
+
+        [[nodiscard]] static constexpr auto get_message_size(usize size) noexcept -> usize {
+            return (sizeof(u64) + size + message_alignment - 1) & ~(message_alignment - 1);
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE(SharedQueue, SharedQueue)
+        KSTD_NO_COPY(SharedQueue, SharedQueue)
+
+        SharedQueue() noexcept :
+                _header {nullptr},
+                _data {nullptr},
+                _capacity {0} {
+        }
+
+        /**
+         * Creates or opens the queue with the given name. The capacity is only
+         * used when the queue is created, and is rounded down to the message alignment.
+         */
+        SharedQueue(std::string name, SharedMode mode, usize capacity = 0) :
+                _mapping {std::move(name), MappingAccess::READ | MappingAccess::WRITE, mode,
+                          capacity == 0 ? 0 : sizeof(SharedQueueHeader) + capacity},
+                _header {static_cast<SharedQueueHeader*>(_mapping.get_address())},
+                _data {static_cast<u8*>(_mapping.get_address()) + sizeof(SharedQueueHeader)},// NOLINT
+                _capacity {(_mapping.get_size() - sizeof(SharedQueueHeader)) & ~(message_alignment - 1)} {
+            if(_mapping.get_size() < sizeof(SharedQueueHeader)) {
+                throw std::runtime_error {
+                        fmt::format("Could not open shared queue {}: region is too small", _mapping.get_name())};
+            }
+
+            if(_mapping.is_owner()) {
+                new(_header) SharedQueueHeader {{0}, SharedQueueHeader::version, _capacity, {0}, {0}};
+                _header->header_magic.store(SharedQueueHeader::magic, std::memory_order_release);
+                return;
+            }
+
+            if(_header->header_magic.load(std::memory_order_acquire) != SharedQueueHeader::magic ||
+               _header->header_version != SharedQueueHeader::version) {
+                throw std::runtime_error {
+                        fmt::format("Could not open shared queue {}: not initialized", _mapping.get_name())};
+            }
+
+            // The header lives in memory another process can write to, so its capacity must fit our mapping
+            const auto header_capacity = _header->capacity;
+
+            if(header_capacity == 0 || header_capacity > _capacity || header_capacity % message_alignment != 0) {
+                throw std::runtime_error {fmt::format("Could not open shared queue {}: invalid capacity {}",
+                                                      _mapping.get_name(), header_capacity)};
+            }
+
+            _capacity = static_cast<usize>(header_capacity);
+        }
+
+        ~SharedQueue() noexcept = default;
+
+        /**
+         * Claims space for a message of the given size, which may be written
+         * directly. Returns an invalid region if the queue is too full.
+         */
+        [[nodiscard]] inline auto try_reserve(usize size) noexcept -> RingRegion {
+            const auto message_size = get_message_size(size);
+            auto head = _header->head.load(std::memory_order_relaxed);
+            const auto tail = _header->tail.load(std::memory_order_acquire);
+            auto offset = static_cast<usize>(head % _capacity);
+            const auto padding = offset + message_size > _capacity ? _capacity - offset : 0;
+
+            if(message_size > _capacity || padding + message_size > _capacity - static_cast<usize>(head - tail)) {
+                return {nullptr, 0, head};
+            }
+
+            if(padding != 0) {
+                // The message would wrap around, so tell the consumer to skip the rest of the buffer
+                std::memcpy(_data + offset, &padding_marker, sizeof(u64));// NOLINT
+                head += padding;
+                offset = 0;
+            }
+
+            const auto length = static_cast<u64>(size);
+            std::memcpy(_data + offset, &length, sizeof(u64));// NOLINT
+            return {_data + offset + sizeof(u64), size, head};// NOLINT
+        }
+
+        inline auto commit(const RingRegion& region) noexcept -> void {
+            _header->head.store(region.position + get_message_size(region.size), std::memory_order_release);
+        }
+
+        /**
+         * Returns the oldest message in the queue without removing
+         * it, or an invalid region if the queue is empty.
+         */
+        [[nodiscard]] inline auto peek() noexcept -> RingRegion {
+            auto tail = _header->tail.load(std::memory_order_relaxed);
+            const auto head = _header->head.load(std::memory_order_acquire);
+
+            if(tail == head) {
+                return {nullptr, 0, tail};
+            }
+
+            auto offset = static_cast<usize>(tail % _capacity);
+            u64 length = 0;
+            std::memcpy(&length, _data + offset, sizeof(u64));// NOLINT
+
+            if(length == padding_marker) {
+                tail += _capacity - offset;
+                _header->tail.store(tail, std::memory_order_release);
+                offset = 0;
+                std::memcpy(&length, _data, sizeof(u64));
+            }
+
+            return {_data + offset + sizeof(u64), static_cast<usize>(length), tail};// NOLINT
+        }
+
+        inline auto release(const RingRegion& region) noexcept -> void {
+            _header->tail.store(region.position + get_message_size(region.size), std::memory_order_release);
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _capacity;
+        }
+
+        [[nodiscard]] inline auto get_mapping() noexcept -> SharedMapping& {
+            return _mapping;
+        }
+    };
+}// namespace kstd::platform::mm
@@ -0,0 +1,406 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "virtual_arena.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <kstd/bitflags.hpp>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace kstd::platform::mm {
+    KSTD_BITFLAGS(u8, SlabFlags, GUARD_PAGES = 0x01U)// NOLINT
+
+    struct SlabStatistics final {
+        u64 allocation_count;
+        u64 free_count;
+        u64 remote_free_count;
+        usize slab_count;
+        usize object_capacity;
+
+        [[nodiscard]] constexpr auto get_live_object_count() const noexcept -> u64 {
+            return allocation_count - free_count;
+        }
+
+        /**
+         * Returns the share of object slots carved out of slabs which are not in use.
+         */
+        [[nodiscard]] constexpr auto get_fragmentation() const noexcept -> f64 {
+            if(object_capacity == 0) {
+                return 0.0;
+            }
+
+            return 1.0 - static_cast<f64>(get_live_object_count()) / static_cast<f64>(object_capacity);
+        }
+    };
+
+    struct SlabFreeNode final {
+        SlabFreeNode* next;
+    };
+
+    struct SlabHeap final {
+        std::atomic<bool> is_orphaned {false};
+        SlabFreeNode* free_list {nullptr};
+        u8* cursor {nullptr};
+        u8* end {nullptr};
+        std::atomic<u64> allocation_count {0};
+        std::atomic<u64> free_count {0};
+        alignas(64) std::atomic<SlabFreeNode*> remote_free_list {nullptr};
+        std::atomic<u64> remote_free_count {0};
+    };
+
+    struct SlabHeader final {
+        SlabHeap* heap;
+    };
+
+    struct SlabThreadHeaps final {
+        std::vector<std::pair<u64, std::shared_ptr<SlabHeap>>> heaps;
+
+        SlabThreadHeaps() noexcept = default;
+
+        // Heaps outlive their thread, so whatever they hold can be taken over by other threads
+        ~SlabThreadHeaps() noexcept {
+            for(const auto& [id, heap] : heaps) {
+                heap->is_orphaned.store(true, std::memory_order_release);
+            }
+        }
+
+        KSTD_NO_COPY(SlabThreadHeaps, SlabThreadHeaps)
+    };
+
+    /**
+     * An allocator for objects of a single size. Every thread allocates from its own
+     * heap without locking, objects freed by other threads are pushed onto a lock-free
+     * list of their owning heap and reused by it later. Slabs are aligned to their size,
+     * so the owning heap of any object is found from its address alone.
+     * When a thread exits, its heap is adopted by the next thread needing one, and
+     * until then other threads take its free objects before carving new slabs.
+     * With SlabFlags::GUARD_PAGES the first page of every slab is made inaccessible,
+     * which catches overruns past the end of the previous slab.
+     */
+    class SlabAllocator final {
+        static inline std::atomic<u64> s_next_id {0};
+
+        VirtualArena _arena;
+        std::vector<std::shared_ptr<SlabHeap>> _heaps;
+        std::mutex _mutex;
+        u64 _id;
+        usize _object_size;
+        usize _alignment;
+        usize _slab_size;
+        usize _header_offset;
+        usize _first_object_offset;
+        usize _objects_per_slab;
+        std::atomic<usize> _slab_count;
+        SlabFlags _flags;
+
+        [[nodiscard]] static inline auto get_thread_heaps() noexcept -> SlabThreadHeaps& {
+            thread_local SlabThreadHeaps t_heaps {};
+            return t_heaps;
+        }
+
+        [[nodiscard]] inline auto find_local_heap() const noexcept -> SlabHeap* {
+            for(const auto& [id, heap] : get_thread_heaps().heaps) {
+                if(id == _id) {
+                    return heap.get();
+                }
+            }
+
+            return nullptr;
+        }
+
+        // Returns nothing if there is no memory left for the bookkeeping of a new heap
+        [[nodiscard]] inline auto get_local_heap() noexcept -> SlabHeap* {
+            if(auto* heap = find_local_heap(); heap != nullptr) {
+                return heap;
+            }
+
+            auto& thread_heaps = get_thread_heaps().heaps;
+            const std::lock_guard lock {_mutex};
+
+            // Heaps of destroyed allocators are only referenced by this thread anymore
+            thread_heaps.erase(std::remove_if(thread_heaps.begin(), thread_heaps.end(),
+                                              [](const auto& entry) { return entry.second.use_count() == 1; }),
+                               thread_heaps.end());
+
+            std::shared_ptr<SlabHeap> heap {};
+
+            for(const auto& candidate : _heaps) {
+                if(candidate->is_orphaned.load(std::memory_order_acquire)) {
+                    heap = candidate;
+                    break;
+                }
+            }
+
+            try {
+                thread_heaps.reserve(thread_heaps.size() + 1);
+
+                if(heap == nullptr) {
+                    _heaps.reserve(_heaps.size() + 1);
+                    heap = _heaps.emplace_back(std::make_shared<SlabHeap>());
+                }
+            }
+            catch(const std::bad_alloc&) {
+                return nullptr;
+            }
+
+            heap->is_orphaned.store(false, std::memory_order_relaxed);
+            thread_heaps.emplace_back(_id, heap);
+            return heap.get();
+        }
+
+        // Takes the free objects or the rest of the current slab of a heap whose thread exited
+        [[nodiscard]] inline auto steal_orphaned(SlabHeap* heap) noexcept -> bool {
+            for(const auto& candidate : _heaps) {
+                if(candidate.get() == heap || !candidate->is_orphaned.load(std::memory_order_acquire)) {
+                    continue;
+                }
+
+                heap->free_list = std::exchange(candidate->free_list, nullptr);
+
+                if(heap->free_list == nullptr) {
+                    heap->free_list = candidate->remote_free_list.exchange(nullptr, std::memory_order_acquire);
+                }
+
+                if(heap->free_list != nullptr) {
+                    return true;
+                }
+
+                if(candidate->cursor != candidate->end) {
+                    heap->cursor = std::exchange(candidate->cursor, nullptr);
+                    heap->end = std::exchange(candidate->end, nullptr);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        [[nodiscard]] inline auto refill(SlabHeap* heap) noexcept -> Result<void> {
+            const std::lock_guard lock {_mutex};
+
+            if(steal_orphaned(heap)) {
+                return {};
+            }
+
+            auto memory = _arena.allocate(_slab_size, _slab_size);
+
+            if(!memory) {
+                return memory.forward<void>();
+            }
+
+            auto* slab = static_cast<u8*>(*memory);
+
+            if((_flags & SlabFlags::GUARD_PAGES) == SlabFlags::GUARD_PAGES) {
+                const auto offset = static_cast<usize>(slab - static_cast<u8*>(_arena.get_address()));
+
+                if(auto result = _arena.protect({offset, _header_offset}, MappingAccess::NONE); !result) {
+                    return result;
+                }
+            }
+
+            new(slab + _header_offset) SlabHeader {heap};// NOLINT
+            heap->cursor = slab + _first_object_offset;   // NOLINT
+            heap->end = heap->cursor + _objects_per_slab * _object_size;// NOLINT
+            _slab_count.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+
+        public:
+        static constexpr usize default_reserved_size = static_cast<usize>(1U) << 30U;
+        static constexpr usize default_slab_size = 64U << 10U;
+
+        /**
+         * Creates an allocator for objects of the given size and alignment which carves slabs
+         * of slab_size bytes, a power of two of at least one page, out of reserved_size bytes
+         * of address space.
+         */
+        explicit SlabAllocator(usize object_size, usize alignment = alignof(std::max_align_t),
+                               SlabFlags flags = SlabFlags::NONE, usize reserved_size = default_reserved_size,
+                               usize slab_size = default_slab_size) :
+                _id {s_next_id.fetch_add(1, std::memory_order_relaxed)},
+                _object_size {0},
+                _alignment {alignment},
+                _slab_size {slab_size},
+                _header_offset {0},
+                _first_object_offset {0},
+                _objects_per_slab {0},
+                _slab_count {0},
+                _flags {flags} {
+            const auto page_size = get_page_size();
+
+            if(slab_size < page_size || (slab_size & (slab_size - 1)) != 0) {
+                throw std::runtime_error {
+                        fmt::format("Could not create slab allocator: invalid slab size {}", slab_size)};
+            }
+
+            if(alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > page_size) {
+                throw std::runtime_error {
+                        fmt::format("Could not create slab allocator: invalid alignment {}", alignment)};
+            }
+
+            const auto align_up = [alignment](usize value) {
+                return (value + alignment - 1) & ~(alignment - 1);
+            };
+
+            _object_size = align_up(std::max(object_size, sizeof(SlabFreeNode)));
+            _header_offset = (flags & SlabFlags::GUARD_PAGES) == SlabFlags::GUARD_PAGES ? page_size : 0;
+            _first_object_offset = align_up(_header_offset + sizeof(SlabHeader));
+
+            if(_first_object_offset + _object_size > slab_size) {
+                throw std::runtime_error {fmt::format("Could not create slab allocator: {} byte objects exceed slab",
+                                                      _object_size)};
+            }
+
+            _objects_per_slab = (slab_size - _first_object_offset) / _object_size;
+            _arena = VirtualArena {reserved_size, slab_size};
+        }
+
+        ~SlabAllocator() noexcept = default;
+
+        KSTD_NO_COPY(SlabAllocator, SlabAllocator)
+
+        [[nodiscard]] inline auto allocate() noexcept -> Result<void*> {
+            auto* heap = get_local_heap();
+
+            if(heap == nullptr) {
+                return Error {std::string("Could not allocate object: out of memory for thread heap")};
+            }
+
+            if(heap->free_list == nullptr) {
+                heap->free_list = heap->remote_free_list.exchange(nullptr, std::memory_order_acquire);
+            }
+
+            if(heap->free_list == nullptr && heap->cursor == heap->end) {
+                if(auto result = refill(heap); !result) {
+                    return result.forward<void*>();
+                }
+            }
+
+            void* object = nullptr;
+
+            if(heap->free_list != nullptr) {
+                object = heap->free_list;
+                heap->free_list = heap->free_list->next;
+            }
+            else {
+                object = heap->cursor;
+                heap->cursor += _object_size;// NOLINT
+            }
+
+            heap->allocation_count.store(heap->allocation_count.load(std::memory_order_relaxed) + 1,
+                                         std::memory_order_relaxed);
+            return object;
+        }
+
+        inline auto deallocate(void* object) noexcept -> void {
+            if(object == nullptr) {
+                return;
+            }
+
+            const auto slab_mask = ~static_cast<uintptr_t>(_slab_size - 1);
+            auto* slab = reinterpret_cast<u8*>(reinterpret_cast<uintptr_t>(object) & slab_mask);// NOLINT
+            auto* heap = reinterpret_cast<SlabHeader*>(slab + _header_offset)->heap;             // NOLINT
+            auto* node = static_cast<SlabFreeNode*>(object);
+
+            if(heap == find_local_heap()) {
+                node->next = heap->free_list;
+                heap->free_list = node;
+                heap->free_count.store(heap->free_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return;
+            }
+
+            auto* head = heap->remote_free_list.load(std::memory_order_relaxed);
+
+            do {
+                node->next = head;
+            } while(!heap->remote_free_list.compare_exchange_weak(head, node, std::memory_order_release,
+                                                                  std::memory_order_relaxed));
+
+            heap->remote_free_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        template<typename T, typename... ARGS>
+        [[nodiscard]] inline auto create(ARGS&&... args) noexcept -> Result<T*> {
+            if(sizeof(T) > _object_size || alignof(T) > _alignment) {
+                return Error {fmt::format("Could not create object: {} bytes exceed slot size", sizeof(T))};
+            }
+
+            auto memory = allocate();
+
+            if(!memory) {
+                return memory.forward<T*>();
+            }
+
+            return new(*memory) T {std::forward<ARGS>(args)...};
+        }
+
+        template<typename T>
+        inline auto destroy(T* object) noexcept -> void {
+            if(object != nullptr) {
+                object->~T();
+                deallocate(object);
+            }
+        }
+
+        [[nodiscard]] inline auto get_statistics() noexcept -> SlabStatistics {
+            const std::lock_guard lock {_mutex};
+            const auto slab_count = _slab_count.load(std::memory_order_relaxed);
+            SlabStatistics statistics {0, 0, 0, slab_count, slab_count * _objects_per_slab};
+
+            for(const auto& heap : _heaps) {
+                const auto remote_free_count = heap->remote_free_count.load(std::memory_order_relaxed);
+                statistics.allocation_count += heap->allocation_count.load(std::memory_order_relaxed);
+                statistics.free_count += heap->free_count.load(std::memory_order_relaxed) + remote_free_count;
+                statistics.remote_free_count += remote_free_count;
+            }
+
+            return statistics;
+        }
+
+        [[nodiscard]] inline auto get_object_size() const noexcept -> usize {
+            return _object_size;
+        }
+
+        [[nodiscard]] inline auto get_alignment() const noexcept -> usize {
+            return _alignment;
+        }
+
+        [[nodiscard]] inline auto get_slab_size() const noexcept -> usize {
+            return _slab_size;
+        }
+
+        [[nodiscard]] inline auto get_objects_per_slab() const noexcept -> usize {
+            return _objects_per_slab;
+        }
+
+        [[nodiscard]] inline auto get_flags() const noexcept -> SlabFlags {
+            return _flags;
+        }
+    };
+}// namespace kstd::platform::mm
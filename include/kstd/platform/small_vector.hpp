@@ -0,0 +1,110 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <kstd/types.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace kstd::platform {
+    /**
+     * A vector of trivially copyable elements which keeps up to N of them inline,
+     * and only moves them to the heap once it grows past that.
+     */
+    template<typename T, usize N>
+    class SmallVector final {
+        static_assert(std::is_trivially_copyable_v<T>, "Small vectors can only hold trivially copyable types");
+
+        std::array<T, N> _inline_elements;
+        std::vector<T> _heap_elements;
+        usize _size;
+
+        public:
+        SmallVector() noexcept :
+                _inline_elements {},
+                _size {0} {
+        }
+
+        inline auto push_back(const T& value) -> void {
+            if(_heap_elements.empty() && _size < N) {
+                _inline_elements[_size++] = value;
+                return;
+            }
+
+            if(_heap_elements.empty()) {
+                _heap_elements.reserve(N * 2);
+                _heap_elements.assign(_inline_elements.cbegin(), _inline_elements.cbegin() + _size);
+            }
+
+            _heap_elements.push_back(value);
+            ++_size;
+        }
+
+        inline auto clear() noexcept -> void {
+            _heap_elements.clear();
+            _size = 0;
+        }
+
+        [[nodiscard]] inline auto is_inline() const noexcept -> bool {
+            return _heap_elements.empty();
+        }
+
+        [[nodiscard]] inline auto data() noexcept -> T* {
+            return is_inline() ? _inline_elements.data() : _heap_elements.data();
+        }
+
+        [[nodiscard]] inline auto data() const noexcept -> const T* {
+            return is_inline() ? _inline_elements.data() : _heap_elements.data();
+        }
+
+        [[nodiscard]] inline auto size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        [[nodiscard]] inline auto operator[](usize index) noexcept -> T& {
+            return data()[index];// NOLINT
+        }
+
+        [[nodiscard]] inline auto operator[](usize index) const noexcept -> const T& {
+            return data()[index];// NOLINT
+        }
+
+        [[nodiscard]] inline auto begin() noexcept -> T* {
+            return data();
+        }
+
+        [[nodiscard]] inline auto end() noexcept -> T* {
+            return data() + _size;// NOLINT
+        }
+
+        [[nodiscard]] inline auto begin() const noexcept -> const T* {
+            return data();
+        }
+
+        [[nodiscard]] inline auto end() const noexcept -> const T* {
+            return data() + _size;// NOLINT
+        }
+    };
+}// namespace kstd::platform
@@ -0,0 +1,158 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "memory_mapping.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+
+namespace kstd::platform::mm {
+    enum class DecommitMode : u8 {
+        RELEASE,
+        LAZY
+    };
+
+    /**
+     * A bump allocator over a reserved range of address space which commits
+     * memory on demand, so allocations never move and the arena can be reset
+     * to any earlier marker in constant time. Not thread-safe.
+     */
+    class VirtualArena final : public MemoryMapping {
+        u8* _address;
+        usize _size;
+        usize _commit_granularity;
+        usize _committed_size;
+        usize _offset;
+        MappingFlags _flags;
+
+        [[nodiscard]] auto commit(usize end) noexcept -> Result<void>;
+
+        public:
+        static constexpr usize default_commit_granularity = 64U << 10U;
+
+        VirtualArena(VirtualArena&& other) noexcept;
+        VirtualArena() noexcept;
+
+        /**
+         * Reserves size bytes of address space without committing any of it.
+         * Memory is committed in steps of commit_granularity, rounded up to whole pages,
+         * and prefaulted as it is committed if MappingFlags::POPULATE is set.
+         */
+        explicit VirtualArena(usize size, usize commit_granularity = default_commit_granularity,
+                              MappingFlags flags = MappingFlags::NONE);
+
+        ~VirtualArena() noexcept;
+
+        auto operator=(VirtualArena&& other) noexcept -> VirtualArena&;
+
+        KSTD_NO_COPY(VirtualArena, VirtualArena)
+
+        [[nodiscard]] auto resize(usize size) noexcept -> Result<void> final;
+
+        using MemoryMapping::sync;
+
+        [[nodiscard]] auto sync() noexcept -> Result<void> final;
+
+        [[nodiscard]] auto get_type() const noexcept -> MappingType final;
+
+        [[nodiscard]] auto get_access() const noexcept -> MappingAccess final;
+
+        [[nodiscard]] auto get_address() const noexcept -> void* final;
+
+        [[nodiscard]] auto get_size() const noexcept -> usize final;
+
+        /**
+         * Returns committed memory past the current marker to the OS. RELEASE makes
+         * it inaccessible until it is committed again, LAZY keeps it committed and
+         * only lets the OS reclaim its contents under memory pressure.
+         */
+        [[nodiscard]] auto decommit(DecommitMode mode = DecommitMode::RELEASE) noexcept -> Result<void>;
+
+        [[nodiscard]] inline auto allocate(usize size, usize alignment = alignof(std::max_align_t)) noexcept
+                -> Result<void*> {
+            if(alignment == 0 || (alignment & (alignment - 1)) != 0) {
+                return Error {fmt::format("Could not allocate from arena: alignment {} is no power of two", alignment)};
+            }
+
+            const auto base = reinterpret_cast<uintptr_t>(_address);// NOLINT
+            const auto begin = ((base + _offset + alignment - 1) & ~(alignment - 1)) - base;
+
+            if(begin > _size || size > _size - begin) {
+                return Error {fmt::format("Could not allocate {} bytes from arena: {} of {} bytes in use", size,
+                                          _offset, _size)};
+            }
+
+            const auto end = begin + size;
+
+            if(end > _committed_size) {
+                if(auto result = commit(end); !result) {
+                    return result.forward<void*>();
+                }
+            }
+
+            _offset = end;
+            return static_cast<void*>(_address + begin);// NOLINT
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto allocate_array(usize count) noexcept -> Result<T*> {
+            static_assert(std::is_trivially_destructible_v<T>, "Arena memory is released without running destructors");
+
+            if(count > _size / sizeof(T)) {
+                return Error {fmt::format("Could not allocate {} elements from arena: exceeds arena size", count)};
+            }
+
+            auto result = allocate(sizeof(T) * count, alignof(T));
+
+            if(!result) {
+                return result.forward<T*>();
+            }
+
+            return static_cast<T*>(*result);
+        }
+
+        [[nodiscard]] inline auto get_marker() const noexcept -> usize {
+            return _offset;
+        }
+
+        /**
+         * Rewinds the arena to a marker returned by get_marker(), which invalidates
+         * everything allocated after it. Committed memory stays committed.
+         */
+        inline auto reset(usize marker = 0) noexcept -> void {
+            _offset = std::min(marker, _offset);
+        }
+
+        [[nodiscard]] inline auto get_committed_size() const noexcept -> usize {
+            return _committed_size;
+        }
+
+        [[nodiscard]] inline auto get_commit_granularity() const noexcept -> usize {
+            return _commit_granularity;
+        }
+
+        [[nodiscard]] inline auto get_flags() const noexcept -> MappingFlags {
+            return _flags;
+        }
+    };
+}// namespace kstd::platform::mm
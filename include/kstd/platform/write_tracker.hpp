@@ -0,0 +1,65 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include "dirty_page_map.hpp"
+#include "memory_mapping.hpp"
+#include <atomic>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <memory>
+
+namespace kstd::platform::mm {
+    struct TrackedRegion final {
+        u8* address;
+        usize size;
+        usize page_size;
+        MappingAccess access;
+        std::atomic<u64>* dirty_words;
+    };
+
+    /**
+     * Write-protects a region of memory and records the first write to every page
+     * in a DirtyPageMap through a process-wide fault handler. Calling protect re-arms
+     * tracking for pages which were written back. Note that the kernel fails system
+     * calls writing into protected pages with EFAULT instead of raising a fault.
+     */
+    class WriteTracker final {
+        std::unique_ptr<TrackedRegion> _region;
+
+        public:
+        WriteTracker(WriteTracker&& other) noexcept;
+        WriteTracker() noexcept;
+
+        WriteTracker(void* address, usize size, MappingAccess access, DirtyPageMap& dirty_pages);
+
+        ~WriteTracker() noexcept;
+
+        auto operator=(WriteTracker&& other) noexcept -> WriteTracker&;
+
+        KSTD_NO_COPY(WriteTracker, WriteTracker)
+
+        [[nodiscard]] auto protect(MappingRange range) noexcept -> Result<void>;
+
+        [[nodiscard]] inline auto is_active() const noexcept -> bool {
+            return _region != nullptr;
+        }
+    };
+}// namespace kstd::platform::mm
@@ -0,0 +1,599 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/async_resolver.hpp"
+#include "kstd/platform/platform.hpp"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <cerrno>
+#include <deque>
+#include <mutex>
+#include <netinet/in.h>
+#include <new>
+#include <queue>
+#include <random>
+#include <resolv.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace kstd::platform {
+    using AsyncClock = std::chrono::steady_clock;
+
+    static constexpr usize max_query_count = 0x10000;// One per ID
+    static constexpr usize max_event_count = 256;
+    static constexpr int receive_buffer_size = 4 * 1024 * 1024;
+
+    struct AsyncSubmission final {
+        std::string address;
+        u16 type;
+        DnsCallback callback;
+    };
+
+    struct AsyncQuery final {
+        std::string address;
+        u16 type;
+        DnsCallback callback;
+        std::array<u8, dns_max_query_size> query;
+        usize query_size;
+        usize attempt;
+        usize server;
+        u64 sequence;// Tells the timeout of the current attempt apart from stale ones
+        bool is_tcp;
+        int tcp_fd;
+        bool is_tcp_writing;
+        std::vector<u8> tcp_buffer;
+        usize tcp_offset;
+    };
+
+    struct AsyncTimeout final {
+        AsyncClock::time_point deadline;
+        u16 id;
+        u64 sequence;
+
+        [[nodiscard]] inline auto operator>(const AsyncTimeout& other) const noexcept -> bool {
+            return deadline > other.deadline;
+        }
+    };
+
+    static auto get_system_nameservers() -> std::vector<sockaddr_in> {
+        struct __res_state state {};
+        std::vector<sockaddr_in> nameservers {};
+
+        if(::res_ninit(&state) != 0) {
+            throw std::runtime_error {fmt::format("Could not initialize resolver: {}", get_last_error())};
+        }
+
+        for(auto index = 0; index < state.nscount; ++index) {
+            if(state.nsaddr_list[index].sin_family == AF_INET) {// NOLINT
+                nameservers.push_back(state.nsaddr_list[index]);// NOLINT
+            }
+        }
+
+        ::res_nclose(&state);
+        return nameservers;
+    }
+
+    struct AsyncResolverState final {
+        std::vector<sockaddr_in> nameservers;
+        std::chrono::milliseconds timeout;
+        usize attempt_count;
+        int epoll_fd;
+        int udp_fd;
+        int wake_fd;
+        std::thread thread;
+        std::mutex mutex;
+        std::vector<AsyncSubmission> submissions;
+        bool is_stopping;
+        std::atomic<usize> query_count;
+        std::atomic<usize> retry_count;
+        std::atomic<usize> timeout_count;
+        std::atomic<usize> truncated_count;
+        std::atomic<usize> pending_count;
+
+        // Only touched by the event thread
+        std::unordered_map<u16, AsyncQuery> queries;
+        std::unordered_map<int, u16> tcp_queries;
+        std::deque<AsyncSubmission> backlog;
+        std::priority_queue<AsyncTimeout, std::vector<AsyncTimeout>, std::greater<>> timeouts;
+        std::mt19937 random;
+        u64 next_sequence;
+
+        AsyncResolverState(std::vector<sockaddr_in> nameservers, std::chrono::milliseconds timeout,
+                           usize attempt_count) :
+                nameservers {std::move(nameservers)},
+                timeout {timeout},
+                attempt_count {attempt_count},
+                epoll_fd {-1},
+                udp_fd {-1},
+                wake_fd {-1},
+                is_stopping {false},
+                query_count {0},
+                retry_count {0},
+                timeout_count {0},
+                truncated_count {0},
+                pending_count {0},
+                random {std::random_device {}()},
+                next_sequence {0} {
+        }
+
+        ~AsyncResolverState() noexcept {
+            if(thread.joinable()) {
+                {
+                    std::scoped_lock lock {mutex};
+                    is_stopping = true;
+                }
+
+                const u64 value = 1;
+                static_cast<void>(::write(wake_fd, &value, sizeof(value)));
+                thread.join();
+            }
+
+            for(const auto fd : {wake_fd, udp_fd, epoll_fd}) {
+                if(fd != -1) {
+                    ::close(fd);
+                }
+            }
+        }
+
+        KSTD_NO_COPY(AsyncResolverState, AsyncResolverState)
+
+        auto complete(u16 id, Result<DnsAnswer> result) -> void {
+            auto node = queries.extract(id);
+            close_tcp(node.mapped());
+            pending_count.fetch_sub(1, std::memory_order_relaxed);
+            node.mapped().callback(std::move(result));
+        }
+
+        auto fail(u16 id, std::string_view reason) -> void {
+            const auto& address = queries.at(id).address;
+            complete(id, Error {fmt::format("Unable to resolve address of {}: {}", address, reason)});
+        }
+
+        auto submit(AsyncSubmission submission) -> void {
+            if(queries.size() >= max_query_count) {
+                backlog.push_back(std::move(submission));
+                return;
+            }
+
+            auto id = static_cast<u16>(random());
+
+            while(queries.find(id) != queries.end()) {
+                id = static_cast<u16>(random());
+            }
+
+            AsyncQuery query {std::move(submission.address), submission.type, std::move(submission.callback),
+                              {}, 0, 0, 0, 0, false, -1, false, {}, 0};
+            const auto query_size = write_dns_query(id, query.address, query.type, query.query);
+
+            if(!query_size) {
+                pending_count.fetch_sub(1, std::memory_order_relaxed);
+                query.callback(Error {fmt::format("Unable to resolve address of {}: Illegal name", query.address)});
+                return;
+            }
+
+            query.query_size = *query_size;
+            send(id, queries.emplace(id, std::move(query)).first->second);
+        }
+
+        // Starts waiting submissions once queries completed, which never recurses as submit doesn't complete any
+        auto drain_backlog() -> void {
+            while(!backlog.empty() && queries.size() < max_query_count) {
+                auto submission = std::move(backlog.front());
+                backlog.pop_front();
+                submit(std::move(submission));
+            }
+        }
+
+        auto send(u16 id, AsyncQuery& query) -> void {
+            query.sequence = next_sequence++;
+            timeouts.push({AsyncClock::now() + timeout, id, query.sequence});
+            query_count.fetch_add(1, std::memory_order_relaxed);
+            const auto& nameserver = nameservers[query.server];
+
+            // Lost datagrams and failed connections are retried once they time out
+            if(!query.is_tcp) {
+                const auto* destination = reinterpret_cast<const sockaddr*>(&nameserver);// NOLINT
+                static_cast<void>(
+                        ::sendto(udp_fd, query.query.data(), query.query_size, 0, destination, sizeof(nameserver)));
+                return;
+            }
+
+            const auto fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+            if(fd == -1) {
+                return;
+            }
+
+            epoll_event event {EPOLLOUT, {}};
+            event.data.fd = fd;
+
+            if((::connect(fd, reinterpret_cast<const sockaddr*>(&nameserver), sizeof(nameserver)) != 0 &&// NOLINT
+                errno != EINPROGRESS) ||
+               ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+                ::close(fd);
+                return;
+            }
+
+            // Messages over TCP are prefixed with their length
+            query.tcp_fd = fd;
+            query.is_tcp_writing = true;
+            query.tcp_buffer.assign({static_cast<u8>(query.query_size >> 8U), static_cast<u8>(query.query_size)});
+            query.tcp_buffer.insert(query.tcp_buffer.end(), query.query.cbegin(),
+                                    query.query.cbegin() + static_cast<std::ptrdiff_t>(query.query_size));
+            query.tcp_offset = 0;
+            tcp_queries.emplace(fd, id);
+        }
+
+        auto retry(u16 id, std::string_view reason) -> void {
+            auto& query = queries.at(id);
+            close_tcp(query);
+
+            if(++query.attempt >= attempt_count) {
+                fail(id, reason);
+                return;
+            }
+
+            retry_count.fetch_add(1, std::memory_order_relaxed);
+            query.server = (query.server + 1) % nameservers.size();
+            send(id, query);
+        }
+
+        auto close_tcp(AsyncQuery& query) noexcept -> void {
+            if(query.tcp_fd == -1) {
+                return;
+            }
+
+            ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, query.tcp_fd, nullptr);
+            ::close(query.tcp_fd);
+            tcp_queries.erase(query.tcp_fd);
+            query.tcp_fd = -1;
+            query.tcp_buffer.clear();
+        }
+
+        auto handle_response(u16 id, const u8* data, usize size) -> void {
+            auto& query = queries.at(id);
+            const auto header = parse_dns_header(data, size);
+
+            if(header->is_truncated() && !query.is_tcp) {
+                truncated_count.fetch_add(1, std::memory_order_relaxed);
+                query.is_tcp = true;
+                send(id, query);
+                return;
+            }
+
+            switch(header->get_response_code()) {
+                case DnsResponseCode::NO_ERROR:
+                case DnsResponseCode::NAME_ERROR: break;
+                default: retry(id, fmt::format("Server failed with code {}", header->flags & 0x000FU)); return;
+            }
+
+            auto answer = parse_dns_answer(data, size, query.type);
+
+            if(!answer) {
+                fail(id, answer.get_error());
+            }
+            else if(answer->response_code == DnsResponseCode::NAME_ERROR) {
+                fail(id, "Name does not exist");
+            }
+            else if(answer->addresses.empty()) {
+                fail(id, "There is no address");
+            }
+            else {
+                complete(id, std::move(answer));
+            }
+        }
+
+        auto receive_udp() -> void {
+            std::array<u8, 4096> buffer {};
+
+            while(true) {
+                sockaddr_in source {};
+                socklen_t source_size = sizeof(source);
+                const auto size = ::recvfrom(udp_fd, buffer.data(), buffer.size(), 0,
+                                             reinterpret_cast<sockaddr*>(&source), &source_size);// NOLINT
+
+                if(size < 0) {
+                    if(errno == EINTR) {
+                        continue;
+                    }
+                    return;
+                }
+
+                const auto is_nameserver = std::any_of(nameservers.cbegin(), nameservers.cend(), [&](const auto& ns) {
+                    return ns.sin_addr.s_addr == source.sin_addr.s_addr && ns.sin_port == source.sin_port;
+                });
+                const auto header = parse_dns_header(buffer.data(), static_cast<usize>(size));
+
+                if(!is_nameserver || !header) {
+                    continue;
+                }
+
+                // Anything which does not match the question of a pending query is dropped, as it may be spoofed
+                const auto query = queries.find(header->id);
+
+                if(query == queries.end() || query->second.is_tcp ||
+                   !is_dns_response_to(query->second.query.data(), query->second.query_size, buffer.data(),
+                                       static_cast<usize>(size))) {
+                    continue;
+                }
+
+                handle_response(header->id, buffer.data(), static_cast<usize>(size));
+            }
+        }
+
+        auto process_tcp(int fd, u32 events) -> void {
+            const auto id = tcp_queries.at(fd);
+            auto& query = queries.at(id);
+
+            if(query.is_tcp_writing) {
+                if((events & (EPOLLERR | EPOLLHUP)) != 0) {
+                    retry(id, "Connection failed");
+                    return;
+                }
+
+                const auto size = ::send(fd, query.tcp_buffer.data() + query.tcp_offset,// NOLINT
+                                         query.tcp_buffer.size() - query.tcp_offset, MSG_NOSIGNAL);
+
+                if(size < 0) {
+                    if(errno != EAGAIN && errno != EINTR) {
+                        retry(id, "Connection failed");
+                    }
+                    return;
+                }
+
+                query.tcp_offset += static_cast<usize>(size);
+
+                if(query.tcp_offset == query.tcp_buffer.size()) {
+                    epoll_event event {EPOLLIN, {}};
+                    event.data.fd = fd;
+                    ::epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event);
+                    query.is_tcp_writing = false;
+                    query.tcp_buffer.assign(2, 0);// Room for the length of the response
+                    query.tcp_offset = 0;
+                }
+                return;
+            }
+
+            while(true) {
+                const auto size = ::recv(fd, query.tcp_buffer.data() + query.tcp_offset,// NOLINT
+                                         query.tcp_buffer.size() - query.tcp_offset, 0);
+
+                if(size <= 0) {
+                    if(size == 0 || (errno != EAGAIN && errno != EINTR)) {
+                        retry(id, "Connection closed");
+                    }
+                    return;
+                }
+
+                query.tcp_offset += static_cast<usize>(size);
+
+                if(query.tcp_offset < query.tcp_buffer.size()) {
+                    continue;
+                }
+
+                if(query.tcp_buffer.size() == 2) {
+                    query.tcp_buffer.resize(2 + read_dns_u16(query.tcp_buffer.data()));
+                    continue;
+                }
+
+                if(!is_dns_response_to(query.query.data(), query.query_size, query.tcp_buffer.data() + 2,// NOLINT
+                                       query.tcp_buffer.size() - 2)) {
+                    retry(id, "Received a mismatched response");
+                    return;
+                }
+
+                handle_response(id, query.tcp_buffer.data() + 2, query.tcp_buffer.size() - 2);// NOLINT
+                return;
+            }
+        }
+
+        auto process_timeouts() -> void {
+            const auto now = AsyncClock::now();
+
+            while(!timeouts.empty() && timeouts.top().deadline <= now) {
+                const auto timeout = timeouts.top();
+                timeouts.pop();
+
+                if(const auto query = queries.find(timeout.id);
+                   query != queries.end() && query->second.sequence == timeout.sequence) {
+                    timeout_count.fetch_add(1, std::memory_order_relaxed);
+                    retry(timeout.id, "Timed out");
+                }
+            }
+        }
+
+        [[nodiscard]] auto get_wait_time() const noexcept -> int {
+            if(timeouts.empty()) {
+                return -1;
+            }
+
+            const auto remaining = timeouts.top().deadline - AsyncClock::now();
+            const auto milliseconds = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+            return static_cast<int>(std::max<decltype(milliseconds)>(milliseconds, 0));
+        }
+
+        auto run() noexcept -> void {
+            std::array<epoll_event, max_event_count> events {};
+            std::vector<AsyncSubmission> submitted {};
+            auto is_running = true;
+
+            while(is_running) {
+                const auto event_count = ::epoll_wait(epoll_fd, events.data(), max_event_count, get_wait_time());
+
+                if(event_count < 0 && errno != EINTR) {
+                    break;
+                }
+
+                // Running out of memory must not take the event thread down, an interrupted query times out later
+                try {
+                    for(auto index = 0; index < event_count; ++index) {
+                        const auto& event = events[index];// NOLINT
+
+                        if(event.data.fd == wake_fd) {
+                            u64 value = 0;
+                            static_cast<void>(::read(wake_fd, &value, sizeof(value)));
+                            std::scoped_lock lock {mutex};
+                            submitted.swap(submissions);
+                            is_running = !is_stopping;
+                        }
+                        else if(event.data.fd == udp_fd) {
+                            receive_udp();
+                        }
+                        else if(tcp_queries.find(event.data.fd) != tcp_queries.end()) {
+                            process_tcp(event.data.fd, event.events);
+                        }
+                    }
+
+                    for(auto& submission : submitted) {
+                        submit(std::move(submission));
+                    }
+
+                    submitted.clear();
+                    process_timeouts();
+                    drain_backlog();
+                }
+                catch(const std::bad_alloc&) {
+                    submitted.clear();
+                }
+            }
+
+            // Everything still pending is failed, so no callback is left waiting
+            {
+                std::scoped_lock lock {mutex};
+                submitted.swap(submissions);
+            }
+
+            backlog.insert(backlog.end(), std::make_move_iterator(submitted.begin()),
+                           std::make_move_iterator(submitted.end()));
+
+            for(auto& submission : backlog) {
+                pending_count.fetch_sub(1, std::memory_order_relaxed);
+                submission.callback(Error {fmt::format("Unable to resolve address of {}: The resolver was stopped",
+                                                       submission.address)});
+            }
+
+            backlog.clear();
+
+            while(!queries.empty()) {
+                fail(queries.begin()->first, "The resolver was stopped");
+            }
+        }
+    };
+
+    AsyncResolver::AsyncResolver(std::vector<std::string> dns_addresses, std::chrono::milliseconds timeout,
+                                 usize attempt_count) {
+        if(attempt_count == 0) {
+            throw std::runtime_error {"Could not create asynchronous resolver: At least one attempt is required"};
+        }
+
+        std::vector<sockaddr_in> nameservers {};
+
+        for(const auto& address : dns_addresses) {
+            nameservers.push_back(parse_nameserver_address(address));
+        }
+
+        if(nameservers.empty()) {
+            nameservers = get_system_nameservers();
+        }
+
+        if(nameservers.empty()) {
+            throw std::runtime_error {"Unable to initialize list of DNS servers: No DNS server specified"};
+        }
+
+        _state = std::make_unique<AsyncResolverState>(std::move(nameservers), timeout, attempt_count);
+        _state->epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+        _state->udp_fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        _state->wake_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+        if(_state->epoll_fd == -1 || _state->udp_fd == -1 || _state->wake_fd == -1) {
+            throw std::runtime_error {fmt::format("Could not create asynchronous resolver: {}", get_last_error())};
+        }
+
+        // Bursts of responses should not overflow the socket before the event thread gets to them
+        ::setsockopt(_state->udp_fd, SOL_SOCKET, SO_RCVBUF, &receive_buffer_size, sizeof(receive_buffer_size));
+
+        for(const auto fd : {_state->udp_fd, _state->wake_fd}) {
+            epoll_event event {EPOLLIN, {}};
+            event.data.fd = fd;
+
+            if(::epoll_ctl(_state->epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+                throw std::runtime_error {fmt::format("Could not create asynchronous resolver: {}", get_last_error())};
+            }
+        }
+
+        _state->thread = std::thread {[state = _state.get()] { state->run(); }};
+    }
+
+    AsyncResolver::AsyncResolver(AsyncResolver&& other) noexcept = default;
+
+    AsyncResolver::~AsyncResolver() noexcept = default;
+
+    auto AsyncResolver::operator=(AsyncResolver&& other) noexcept -> AsyncResolver& = default;
+
+    auto AsyncResolver::resolve(const std::string& address, RecordType type, DnsCallback callback) -> void {
+        if(_state == nullptr) {
+            callback(Error {fmt::format("Unable to resolve address of {}: The resolver was moved", address)});
+            return;
+        }
+
+        auto is_idle = false;
+
+        {
+            std::scoped_lock lock {_state->mutex};
+            is_idle = _state->submissions.empty();
+            _state->submissions.push_back({address, static_cast<u16>(type), std::move(callback)});
+            _state->pending_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // The event thread takes all submissions at once, so it only needs to be woken for the first one
+        if(is_idle) {
+            const u64 value = 1;
+            static_cast<void>(::write(_state->wake_fd, &value, sizeof(value)));
+        }
+    }
+
+    auto AsyncResolver::resolve(const std::string& address, RecordType type) -> std::future<Result<DnsAnswer>> {
+        auto promise = std::make_shared<std::promise<Result<DnsAnswer>>>();
+        auto future = promise->get_future();
+        resolve(address, type, [promise](Result<DnsAnswer> result) { promise->set_value(std::move(result)); });
+        return future;
+    }
+
+    auto AsyncResolver::get_statistics() const noexcept -> AsyncResolverStatistics {
+        if(_state == nullptr) {
+            return {};
+        }
+
+        return {_state->query_count.load(std::memory_order_relaxed),
+                _state->retry_count.load(std::memory_order_relaxed),
+                _state->timeout_count.load(std::memory_order_relaxed),
+                _state->truncated_count.load(std::memory_order_relaxed),
+                _state->pending_count.load(std::memory_order_relaxed)};
+    }
+}// namespace kstd::platform
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,105 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/code_allocator.hpp"
+
+#include <sys/mman.h>
+
+namespace kstd::platform::mm {
+    CodeAllocator::CodeAllocator(CodeAllocator&& other) noexcept :
+            _chunks {std::move(other._chunks)},
+            _free_blocks {std::move(other._free_blocks)},
+            _free_size {other._free_size},
+            _chunk_size {other._chunk_size} {
+        other._chunks.clear();
+        other._free_size = 0;
+    }
+
+    CodeAllocator::CodeAllocator(usize chunk_size) noexcept :
+            _free_size {0},
+            _chunk_size {chunk_size} {
+    }
+
+    CodeAllocator::~CodeAllocator() noexcept {
+        std::for_each(_chunks.cbegin(), _chunks.cend(), unmap_chunk);
+    }
+
+    auto CodeAllocator::operator=(CodeAllocator&& other) noexcept -> CodeAllocator& {
+        if(this == &other) {
+            return *this;
+        }
+
+        CodeAllocator previous {std::move(*this)};// Releases our current chunks at the end of the scope
+        _chunks = std::move(other._chunks);
+        _free_blocks = std::move(other._free_blocks);
+        _free_size = other._free_size;
+        _chunk_size = other._chunk_size;
+        other._chunks.clear();
+        other._free_size = 0;
+        return *this;
+    }
+
+    auto CodeAllocator::map_chunk(usize size) noexcept -> Result<CodeChunk> {
+        const auto handle = ::memfd_create("kstd-code", MFD_CLOEXEC);
+
+        if(handle == invalid_file_handle) {
+            return Error {fmt::format("Could not create code memory: {}", get_last_error())};
+        }
+
+        if(::ftruncate(handle, static_cast<NativeOffset>(size)) != 0) {
+            const auto error = get_last_error();
+            ::close(handle);
+            return Error {fmt::format("Could not resize code memory: {}", error)};
+        }
+
+        auto* writable = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0);
+        auto* executable = ::mmap(nullptr, size, PROT_READ | PROT_EXEC, MAP_SHARED, handle, 0);
+        const auto error = get_last_error();
+        ::close(handle);// Both views keep the memory alive
+
+        if(writable == MAP_FAILED || executable == MAP_FAILED) {
+            if(writable != MAP_FAILED) {
+                ::munmap(writable, size);
+            }
+
+            if(executable != MAP_FAILED) {
+                ::munmap(executable, size);
+            }
+
+            return Error {fmt::format("Could not map code memory: {}", error)};
+        }
+
+        return CodeChunk {static_cast<u8*>(writable), static_cast<u8*>(executable), size, 0, 0, 0, 0};
+    }
+
+    auto CodeAllocator::unmap_chunk(const CodeChunk& chunk) noexcept -> void {
+        ::munmap(chunk.writable, chunk.size);
+        ::munmap(chunk.executable, chunk.size);
+    }
+
+    auto CodeAllocator::flush_instruction_cache(const void* address, usize size) noexcept -> Result<void> {
+        auto* begin = static_cast<char*>(const_cast<void*>(address));// NOLINT
+        __builtin___clear_cache(begin, begin + size);                // NOLINT
+        return {};
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_LINUX
@@ -20,65 +20,414 @@
 #ifdef PLATFORM_LINUX
 
 #include "kstd/platform/dns.hpp"
+#include <algorithm>
+#include <chrono>
+#include <poll.h>
+#include <random>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <unordered_map>
 
 namespace kstd::platform {
+    static constexpr usize pipeline_batch_size = 64;
+
+    // Keeps a bounded window of queries in flight on one UDP socket, sending and receiving them in batches
+    struct DnsPipeline final {
+        using Clock = std::chrono::steady_clock;
+
+        struct Slot final {
+            usize item;
+            u16 id;
+            std::array<u8, dns_max_query_size> query;
+            usize query_size;
+            usize attempt;
+            usize server;
+            Clock::time_point deadline;
+        };
+
+        std::vector<sockaddr_in> nameservers;
+        std::chrono::seconds timeout;
+        usize attempt_count;
+        int fd;
+        std::vector<Slot> slots;
+        std::vector<usize> free_slots;
+        std::vector<usize> unsent_slots;
+        std::unordered_map<u16, usize> in_flight;
+        std::mt19937 random;
+
+        DnsPipeline(const struct __res_state& state, usize window_size) :
+                timeout {std::max(state.retrans, 1)},
+                attempt_count {static_cast<usize>(std::max(state.retry, 1))},
+                fd {::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)},
+                slots(std::max<usize>(window_size, 1)),
+                random {std::random_device {}()} {
+            for(auto index = 0; index < state.nscount; ++index) {
+                if(state.nsaddr_list[index].sin_family == AF_INET) {// NOLINT
+                    nameservers.push_back(state.nsaddr_list[index]);// NOLINT
+                }
+            }
+
+            for(auto slot = slots.size(); slot > 0; --slot) {
+                free_slots.push_back(slot - 1);
+            }
+
+            in_flight.reserve(slots.size());
+        }
+
+        ~DnsPipeline() noexcept {
+            if(fd != -1) {
+                ::close(fd);
+            }
+        }
+
+        KSTD_NO_COPY(DnsPipeline, DnsPipeline)
+
+        [[nodiscard]] auto is_usable() const noexcept -> bool {
+            return fd != -1 && !nameservers.empty();
+        }
+
+        // Takes a free slot for the given query and queues it for sending, or returns false if the name is malformed
+        auto start(usize item, const std::string& address, u16 type) noexcept -> bool {
+            const auto slot_index = free_slots.back();
+            auto& slot = slots[slot_index];
+            auto id = static_cast<u16>(random());
+
+            while(in_flight.find(id) != in_flight.end()) {
+                id = static_cast<u16>(random());
+            }
+
+            const auto query_size = write_dns_query(id, address, type, slot.query);
+
+            if(!query_size) {
+                return false;
+            }
+
+            slot.item = item;
+            slot.id = id;
+            slot.query_size = *query_size;
+            slot.attempt = 0;
+            slot.server = item % nameservers.size();// Spreads the load across all nameservers
+            free_slots.pop_back();
+            in_flight.emplace(id, slot_index);
+            unsent_slots.push_back(slot_index);
+            return true;
+        }
+
+        auto finish(usize slot_index) noexcept -> void {
+            in_flight.erase(slots[slot_index].id);
+            free_slots.push_back(slot_index);
+        }
+
+        // Queues the slot again for the next nameserver, or returns false once it ran out of attempts
+        auto retry(usize slot_index) noexcept -> bool {
+            auto& slot = slots[slot_index];
+
+            if(++slot.attempt >= attempt_count) {
+                return false;
+            }
+
+            slot.server = (slot.server + 1) % nameservers.size();
+            slot.deadline = Clock::time_point::max();// Must not expire and be retried again before it is sent
+            unsent_slots.push_back(slot_index);
+            return true;
+        }
+
+        // Sends all queued queries with as few syscalls as possible, what fails to send is retried on its timeout
+        auto send() noexcept -> void {
+            std::array<mmsghdr, pipeline_batch_size> messages {};
+            std::array<iovec, pipeline_batch_size> vectors {};
+            const auto deadline = Clock::now() + timeout;
+
+            for(usize offset = 0; offset < unsent_slots.size(); offset += pipeline_batch_size) {
+                const auto count = std::min(pipeline_batch_size, unsent_slots.size() - offset);
+
+                for(usize index = 0; index < count; ++index) {
+                    auto& slot = slots[unsent_slots[offset + index]];
+                    slot.deadline = deadline;
+                    vectors[index] = {slot.query.data(), slot.query_size};
+                    messages[index].msg_hdr = {&nameservers[slot.server], sizeof(sockaddr_in), &vectors[index], 1,
+                                               nullptr, 0, 0};
+                }
+
+                static_cast<void>(::sendmmsg(fd, messages.data(), static_cast<unsigned int>(count), 0));
+            }
+
+            unsent_slots.clear();
+        }
+
+        [[nodiscard]] auto get_wait_time() const noexcept -> int {
+            auto deadline = Clock::time_point::max();
+
+            for(const auto& [id, slot_index] : in_flight) {
+                deadline = std::min(deadline, slots[slot_index].deadline);
+            }
+
+            const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - Clock::now()).count();
+            return static_cast<int>(std::clamp<decltype(remaining)>(remaining, 0, timeout.count() * 1000));
+        }
+
+        // Waits for responses and passes each one matching a query in flight to the handler along with its slot
+        template<typename F>
+        auto receive(F&& handler) -> void {
+            pollfd poll_fd {fd, POLLIN, 0};
+
+            if(::poll(&poll_fd, 1, get_wait_time()) <= 0) {
+                return;
+            }
+
+            std::array<std::array<u8, dns_max_udp_size>, pipeline_batch_size> buffers {};
+            std::array<mmsghdr, pipeline_batch_size> messages {};
+            std::array<iovec, pipeline_batch_size> vectors {};
+            std::array<sockaddr_in, pipeline_batch_size> sources {};
+
+            while(true) {
+                for(usize index = 0; index < pipeline_batch_size; ++index) {
+                    vectors[index] = {buffers[index].data(), buffers[index].size()};
+                    messages[index].msg_hdr = {&sources[index], sizeof(sockaddr_in), &vectors[index], 1, nullptr, 0, 0};
+                }
+
+                const auto count = ::recvmmsg(fd, messages.data(), pipeline_batch_size, MSG_DONTWAIT, nullptr);
+
+                if(count <= 0) {
+                    return;
+                }
+
+                for(auto index = 0; index < count; ++index) {
+                    const auto& source = sources[index];// NOLINT
+                    const auto* data = buffers[index].data();// NOLINT
+                    const auto size = static_cast<usize>(messages[index].msg_len);// NOLINT
+                    const auto header = parse_dns_header(data, size);
+                    const auto is_nameserver =
+                            std::any_of(nameservers.cbegin(), nameservers.cend(), [&](const auto& nameserver) {
+                                return nameserver.sin_addr.s_addr == source.sin_addr.s_addr &&
+                                       nameserver.sin_port == source.sin_port;
+                            });
+
+                    if(!header || !is_nameserver) {
+                        continue;
+                    }
+
+                    // Responses which do not match the question of their query may be spoofed, so they are dropped
+                    const auto slot = in_flight.find(header->id);
+
+                    if(slot == in_flight.end() || !is_dns_response_to(slots[slot->second].query.data(),
+                                                                      slots[slot->second].query_size, data, size)) {
+                        continue;
+                    }
+
+                    const auto is_truncated = (messages[index].msg_hdr.msg_flags & MSG_TRUNC) != 0;// NOLINT
+                    handler(slot->second, data, size, is_truncated || header->is_truncated());
+                }
+            }
+        }
+    };
+
     Resolver::Resolver(const std::vector<std::string> dns_addresses) :
-            _dns_addresses {dns_addresses} {
+            Resolver {} {
         if(dns_addresses.size() == 0) {
             throw std::runtime_error("Unable to initialize list of DNS servers: No DNS server specified");
         }
+
+        if(dns_addresses.size() > MAXNS) {
+            throw std::runtime_error {fmt::format(
+                    "Unable to initialize list of DNS servers: Only up to {} DNS servers are supported", MAXNS)};
+        }
+
+        for(usize index = 0; index < dns_addresses.size(); ++index) {
+            _state->nsaddr_list[index] = parse_nameserver_address(dns_addresses[index]);// NOLINT
+        }
+
+        _state->nscount = static_cast<int>(dns_addresses.size());
     }
 
     Resolver::Resolver() :
-            _dns_addresses {} {
+            _state {},
+            _cache {std::make_shared<DnsCache<DnsAnswer>>()} {
+        auto state = std::make_unique<struct __res_state>();
+
+        if(::res_ninit(state.get()) != 0) {
+            throw std::runtime_error {fmt::format("Could not initialize resolver: {}", get_last_error())};
+        }
+
+        _state.reset(state.release());// Only closed once it was initialized
     }
 
     Resolver::~Resolver() {
     }
 
-    auto Resolver::resolve(const std::string& address, const RecordType type) noexcept -> kstd::Result<std::string> {
-        if(address == "localhost") {
-            switch(type) {
-                case RecordType::A: return kstd::Result<std::string> {"127.0.0.1"};
-                case RecordType::AAAA: return kstd::Result<std::string> {"::1"};
+    auto Resolver::resolve_many(const std::vector<std::string>& addresses, const std::vector<RecordType>& types,
+                                usize window_size) -> std::vector<kstd::Result<DnsAnswer>> {
+        const auto count = addresses.size() * types.size();
+        std::vector<kstd::Result<DnsAnswer>> results(count, kstd::Error {std::string("Not resolved")});
+        std::vector<usize> pending {};
+        std::vector<usize> fallback {};// Truncated responses are repeated by res_nquery, which switches to TCP
+
+        for(usize item = 0; item < count; ++item) {
+            const auto& address = addresses[item / types.size()];
+            const auto type = types[item % types.size()];
+
+            if(address == "localhost") {
+                results[item] = resolve(address, type);
+            }
+            else if(auto cached = find_cached(address, type); cached) {
+                results[item] = std::move(*cached);
+            }
+            else {
+                pending.push_back(item);
             }
         }
 
-        // Init resolv API
-        res_init();
+        DnsPipeline pipeline {*_state, window_size};
+
+        if(!pipeline.is_usable()) {
+            fallback = std::move(pending);
+            pending.clear();
+        }
+
+        const auto fail = [&](usize item, std::string_view reason) {
+            results[item] = kstd::Error {fmt::format("Unable to resolve address of {}: {}",
+                                                     addresses[item / types.size()], reason)};
+        };
+
+        const auto handle_response = [&](usize slot_index, const u8* data, usize size, bool is_truncated) {
+            const auto item = pipeline.slots[slot_index].item;
+            const auto& address = addresses[item / types.size()];
+            const auto type = static_cast<u16>(types[item % types.size()]);
+            const auto response_code = parse_dns_header(data, size)->get_response_code();
 
-        // Generate custom nameserver list if needed
-        if(_dns_addresses.size() > 0) {
-            _res.nscount = _dns_addresses.size();
-            for(int i = 0; i < _res.nscount; ++i) {
-                if(is_ipv4_address(_dns_addresses[i])) {
-                    _res.nsaddr_list[i].sin_family = AF_INET;
+            if(is_truncated) {
+                fallback.push_back(item);
+            }
+            else if(response_code != DnsResponseCode::NO_ERROR && response_code != DnsResponseCode::NAME_ERROR) {
+                if(pipeline.retry(slot_index)) {
+                    return;// Another nameserver may do better
+                }
+
+                fail(item, fmt::format("Server failed with code {}", static_cast<u8>(response_code)));
+            }
+            else if(auto answer = parse_dns_answer(data, size, type); !answer) {
+                fail(item, answer.get_error());
+            }
+            else if(answer->is_negative()) {
+                fail(item, answer->addresses.empty() && response_code == DnsResponseCode::NO_ERROR
+                                   ? "There is no address"
+                                   : "Name does not exist");
+
+                if(_cache != nullptr && answer->ttl != 0) {
+                    _cache->insert_negative(address, type, results[item].get_error(),
+                                            std::chrono::seconds {answer->ttl});
+                }
+            }
+            else {
+                if(_cache != nullptr) {
+                    _cache->insert(address, type, *answer, std::chrono::seconds {answer->ttl});
                 }
-                else if(is_ipv6_address(_dns_addresses[i])) {
-                    _res.nsaddr_list[i].sin_family = AF_INET6;
+
+                results[item] = std::move(answer);
+            }
+
+            pipeline.finish(slot_index);
+        };
+
+        for(usize next = 0; next < pending.size() || !pipeline.in_flight.empty();) {
+            while(next < pending.size() && !pipeline.free_slots.empty()) {
+                const auto item = pending[next++];
+
+                if(!pipeline.start(item, addresses[item / types.size()],
+                                   static_cast<u16>(types[item % types.size()]))) {
+                    fail(item, "Illegal name");
+                }
+            }
+
+            pipeline.send();
+
+            // Names which failed to start leave nothing to wait for
+            if(!pipeline.in_flight.empty()) {
+                pipeline.receive(handle_response);
+            }
+
+            const auto now = DnsPipeline::Clock::now();
+            std::vector<usize> expired {};
+
+            for(const auto& [id, slot_index] : pipeline.in_flight) {
+                if(pipeline.slots[slot_index].deadline <= now) {
+                    expired.push_back(slot_index);
                 }
-                else {
-                    return kstd::Error {fmt::format("Unable to resolve address of {}: Illegal DNS server address {}",
-                                                    address, _dns_addresses[i])};
+            }
+
+            for(const auto slot_index : expired) {
+                if(!pipeline.retry(slot_index)) {
+                    fail(pipeline.slots[slot_index].item, "Timed out");
+                    pipeline.finish(slot_index);
                 }
-                _res.nsaddr_list[i].sin_addr.s_addr = ::inet_addr(_dns_addresses[i].c_str());
-                _res.nsaddr_list[i].sin_port = htons(53);
             }
         }
 
+        for(const auto item : fallback) {
+            results[item] = resolve(addresses[item / types.size()], types[item % types.size()]);
+        }
+
+        return results;
+    }
+
+    auto Resolver::set_timeout(std::chrono::seconds timeout, usize attempt_count) noexcept -> void {
+        _state->retrans = static_cast<int>(std::max<std::chrono::seconds::rep>(timeout.count(), 1));
+        _state->retry = static_cast<int>(std::max<usize>(attempt_count, 1));
+    }
+
+    auto Resolver::resolve(const std::string& address, const RecordType type) noexcept -> kstd::Result<DnsAnswer> {
+        if(address == "localhost") {
+            switch(type) {
+                case RecordType::A: return get_loopback_answer(false);
+                case RecordType::AAAA: return get_loopback_answer(true);
+            }
+        }
+
+        if(auto cached = find_cached(address, type); cached) {
+            return *cached;
+        }
+
         // Send DNS request
         std::array<u_char, 4096> response_buffer {'\0'};
-        kstd::isize response_length = ::res_query(address.c_str(), C_IN, static_cast<int>(type), response_buffer.data(),
-                                                  sizeof(response_buffer));
+        kstd::isize response_length = ::res_nquery(_state.get(), address.c_str(), C_IN, static_cast<int>(type),
+                                                   response_buffer.data(), sizeof(response_buffer));
 
         if(response_length < 0) {
-            return kstd::Error {fmt::format("Unable to resolve address of {}: {}", address, get_last_error())};
+            auto message = fmt::format("Unable to resolve address of {}: {}", address, get_last_error());
+
+            // The response is left in the buffer even if it carries an error, so NXDOMAIN can be cached too
+            if(_cache != nullptr) {
+                const auto record_type = static_cast<u16>(type);
+                const auto answer = parse_dns_answer(response_buffer.data(), response_buffer.size(), record_type);
+
+                if(answer && answer->is_negative() && answer->ttl != 0) {
+                    _cache->insert_negative(address, record_type, message, std::chrono::seconds {answer->ttl});
+                }
+            }
+
+            return kstd::Error {std::move(message)};
         }
 
         if(response_length == 0) {
             return kstd::Error {fmt::format("Unable to resolve address of {}: There is no response", address)};
         }
-        return std::string {response_buffer.cbegin(), response_buffer.cbegin() + response_length + 1};
+
+        const auto response_size = static_cast<usize>(response_length);
+        auto answer = parse_dns_answer(response_buffer.data(), response_size, static_cast<u16>(type));
+
+        if(!answer) {
+            return kstd::Error {fmt::format("Unable to resolve address of {}: {}", address, answer.get_error())};
+        }
+
+        if(answer->addresses.empty()) {
+            return kstd::Error {fmt::format("Unable to resolve address of {}: There is no address", address)};
+        }
+
+        if(_cache != nullptr) {
+            _cache->insert(address, static_cast<u16>(type), *answer, std::chrono::seconds {answer->ttl});
+        }
+
+        return answer;
     }
 }// namespace kstd::platform
 
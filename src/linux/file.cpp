@@ -21,8 +21,12 @@
 
 #include "kstd/platform/file.hpp"
 
+#include <cerrno>
 #include <kstd/utils.hpp>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
+#include <vector>
 
 #if defined(CPU_64_BIT)
 #define KSTD_FSTAT ::fstat64
@@ -34,7 +38,43 @@
 #define KSTD_FILE_STAT struct stat
 #endif
 
+// Older kernel headers don't know about cachestat yet, the number is shared by all architectures
+#ifndef __NR_cachestat
+#define __NR_cachestat 451
+#endif
+
 namespace kstd::platform::file {
+    struct CachestatRange final {
+        u64 offset;
+        u64 length;
+    };
+
+    struct Cachestat final {
+        u64 nr_cache;
+        u64 nr_dirty;
+        u64 nr_writeback;
+        u64 nr_evicted;
+        u64 nr_recently_evicted;
+    };
+
+    struct PageSpan final {
+        usize offset;
+        usize size;
+        usize page_count;
+    };
+
+    // Clamps the byte range to the file and widens it to page boundaries
+    [[nodiscard]] static auto to_page_span(usize offset, usize size, usize file_size, usize page_size) noexcept
+            -> PageSpan {
+        if(size == 0 || size > file_size - offset) {
+            size = file_size - offset;
+        }
+
+        const auto begin = offset - (offset % page_size);
+        const auto end = ((offset + size + page_size - 1) / page_size) * page_size;
+        return {begin, end - begin, (end - begin) / page_size};
+    }
+
     File::File(const File& other) :
             File(other._path, other._mode) {
     }
@@ -159,6 +199,16 @@ namespace kstd::platform::file {
         return static_cast<usize>(stats.st_size);
     }
 
+    auto File::get_identity() const noexcept -> Result<FileIdentity> {
+        KSTD_FILE_STAT stats {};
+
+        if(KSTD_FSTAT(_handle, &stats) != 0) {
+            return Error {fmt::format("Could not retrieve file identity for {}: {}", _path.string(), get_last_error())};
+        }
+
+        return FileIdentity {static_cast<u64>(stats.st_dev), static_cast<u64>(stats.st_ino)};
+    }
+
     auto File::resize(usize size) const noexcept -> Result<void> {
         if(KSTD_FTRUNCATE(_handle, static_cast<NativeOffset>(size)) == -1) {
             return Error {fmt::format("Could not set file pointer for {}: {}", _path.string(), get_last_error())};
@@ -167,6 +217,96 @@ namespace kstd::platform::file {
         return {};
     }
 
+    auto File::get_cache_statistics(usize offset, usize size) const noexcept -> Result<CacheStatistics> {
+        const auto file_size = get_size();
+
+        if(!file_size) {
+            return file_size.forward<CacheStatistics>();
+        }
+
+        if(offset > *file_size) {
+            return Error {fmt::format("Could not query cache statistics of {}: offset {} exceeds file size {}",
+                                      _path.string(), offset, *file_size)};
+        }
+
+        const auto page_size = get_page_size();
+        const auto span = to_page_span(offset, size, *file_size, page_size);
+        CachestatRange range {span.offset, span.size};
+        Cachestat stats {};
+
+        if(span.page_count == 0) {
+            return CacheStatistics {page_size, 0, 0, 0, 0, 0, 0};
+        }
+
+        if(::syscall(__NR_cachestat, static_cast<i32>(_handle), &range, &stats, 0) == 0) {
+            return CacheStatistics {page_size,
+                                    span.page_count,
+                                    static_cast<usize>(stats.nr_cache),
+                                    static_cast<usize>(stats.nr_dirty),
+                                    static_cast<usize>(stats.nr_writeback),
+                                    static_cast<usize>(stats.nr_evicted),
+                                    static_cast<usize>(stats.nr_recently_evicted)};
+        }
+
+        // Kernels before 6.5 and seccomp filters reject the syscall, count resident pages instead
+        if(errno != ENOSYS && errno != EPERM) {
+            return Error {fmt::format("Could not query cache statistics of {}: {}", _path.string(), get_last_error())};
+        }
+
+        auto residency = get_residency(offset, size);
+
+        if(!residency) {
+            return residency.forward<CacheStatistics>();
+        }
+
+        return CacheStatistics {page_size, span.page_count, residency->get_resident_page_count(), 0, 0, 0, 0};
+    }
+
+    auto File::get_residency(usize offset, usize size) const noexcept -> Result<PageResidency> {
+        const auto file_size = get_size();
+
+        if(!file_size) {
+            return file_size.forward<PageResidency>();
+        }
+
+        if(offset > *file_size) {
+            return Error {fmt::format("Could not query residency of {}: offset {} exceeds file size {}",
+                                      _path.string(), offset, *file_size)};
+        }
+
+        const auto page_size = get_page_size();
+        const auto span = to_page_span(offset, size, *file_size, page_size);
+        PageResidency residency {page_size, span.page_count};
+
+        if(span.page_count == 0) {
+            return residency;
+        }
+
+        // Mapping without touching faults nothing in, so mincore reports the page cache itself
+        const auto native_offset = static_cast<NativeOffset>(span.offset);
+        auto* address = ::mmap(nullptr, span.size, PROT_READ, MAP_SHARED, _handle, native_offset);
+
+        if(address == MAP_FAILED) {
+            return Error {fmt::format("Could not map {} for residency query: {}", _path.string(), get_last_error())};
+        }
+
+        std::vector<unsigned char> pages(span.page_count);
+        const auto is_queried = ::mincore(address, span.size, pages.data()) == 0;
+        const auto error = is_queried ? std::string {} : get_last_error();
+        ::munmap(address, span.size);
+
+        if(!is_queried) {
+            return Error {fmt::format("Could not query residency of {}: {}", _path.string(), error)};
+        }
+
+        for(usize page = 0; page < span.page_count; ++page) {
+            if((pages[page] & 1U) != 0) {
+                residency.mark_resident(page);
+            }
+        }
+
+        return residency;
+    }
 }// namespace kstd::platform::file
 
 #endif// PLATFORM_LINUX
\ No newline at end of file
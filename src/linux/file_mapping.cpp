@@ -29,112 +29,148 @@
 
 namespace kstd::platform::mm {
     FileMapping::FileMapping(const kstd::platform::mm::FileMapping& other) :
-            FileMapping(other._file.get_path(), other._access) {
+            FileMapping(other._file.get_path(), other._access, other._flags) {
     }
 
     FileMapping::FileMapping(kstd::platform::mm::FileMapping&& other) noexcept :
             _file {std::move(other._file)},
             _type {other._type},
             _access {other._access},
-            _address {other._address} {
+            _flags {other._flags},
+            _address {other._address},
+            _size {other._size},
+            _dirty_pages {std::move(other._dirty_pages)},
+            _write_tracker {std::move(other._write_tracker)} {
         other._address = nullptr;
+        other._size = 0;
     }
 
     FileMapping::FileMapping() noexcept :
             _type {MappingType::FILE},
             _access {MappingAccess::NONE},
-            _address {nullptr} {
+            _flags {MappingFlags::NONE},
+            _address {nullptr},
+            _size {0} {
     }
 
-    FileMapping::FileMapping(std::filesystem::path path, MappingAccess access) :
-            _file {file::File {std::move(path), derive_file_mode(access)}},
+    FileMapping::FileMapping(std::filesystem::path path, MappingAccess access, MappingFlags flags) :
+            _file {file::File {std::move(path), derive_checked_file_mode(access, flags)}},
             _type {MappingType::FILE},
             _access {access},
-            _address {} {
-        const auto is_readable = (_access & MappingAccess::READ) == MappingAccess::READ;
-        const auto is_writable = (_access & MappingAccess::WRITE) == MappingAccess::WRITE;
-        const auto is_executable = (_access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE;
-
-        if(is_executable && !_file.is_executable()) {
-            _file.set_executable().throw_if_error();
-        }
-
+            _flags {flags},
+            _address {nullptr},
+            _size {0} {
         auto size = _file.get_size().get_or(0);
 
         if(size == 0) {
+            // The file was opened read-only and a private mapping must never change it
+            if((_flags & MappingFlags::PRIVATE) == MappingFlags::PRIVATE) {
+                throw std::runtime_error {
+                        fmt::format("Could not privately map {}: the file is empty", _file.get_path().string())};
+            }
+
             _file.resize(1).throw_if_error();
             size = 1;// Make sure we map at least one byte of data
         }
 
-        i32 prot = 0;
-        i32 map_flags = MAP_SHARED | MAP_FILE;
-
-        if(is_readable) {
-            prot |= PROT_READ;
-        }
-
-        if(is_writable) {
-            prot |= PROT_WRITE;
-        }
-
-        if(is_executable) {
-            prot |= PROT_EXEC;
-            map_flags |= MAP_EXECUTABLE;
-        }
-
-        _address = KSTD_MMAP(nullptr, size, prot, map_flags, _file.get_handle(), 0);
-
-        if(_address == nullptr) {
-            throw std::runtime_error {
-                    fmt::format("Could not map file {}: {}", _file.get_path().string(), get_last_error())};
-        }
+        _address = map(size).get_or_throw();
+        _size = size;
+        _dirty_pages = DirtyPageMap {_size};
     }
 
     auto FileMapping::operator=(const kstd::platform::mm::FileMapping& other) -> FileMapping& {
         if(this == &other) {
             return *this;
         }
-        *this = FileMapping {other._file.get_path(), other._access};
+        *this = FileMapping {other._file.get_path(), other._access, other._flags};
         return *this;
     }
 
     auto FileMapping::operator=(kstd::platform::mm::FileMapping&& other) noexcept -> FileMapping& {
+        if(this == &other) {
+            return *this;
+        }
+
+        FileMapping previous {std::move(*this)};// Releases our current mapping at the end of the scope
         _file = std::move(other._file);
         _type = other._type;
         _access = other._access;
+        _flags = other._flags;
         _address = other._address;
+        _size = other._size;
+        _dirty_pages = std::move(other._dirty_pages);
+        _write_tracker = std::move(other._write_tracker);
         other._address = nullptr;
+        other._size = 0;
         return *this;
     }
 
-    FileMapping::~FileMapping() noexcept {
-        if(_address != nullptr) {
-            const auto size = _file.get_size().get_or(0);
+    auto FileMapping::map(usize size) noexcept -> Result<void*> {
+        i32 prot = 0;
+        const auto is_private = (_flags & MappingFlags::PRIVATE) == MappingFlags::PRIVATE;
+        i32 map_flags = (is_private ? MAP_PRIVATE : MAP_SHARED) | MAP_FILE;
 
-            if(size == 0) {
-                return;
-            }
+        if((_access & MappingAccess::READ) == MappingAccess::READ) {
+            prot |= PROT_READ;
+        }
+
+        if((_access & MappingAccess::WRITE) == MappingAccess::WRITE) {
+            prot |= PROT_WRITE;
+        }
+
+        if((_access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE) {
+            prot |= PROT_EXEC;
+            map_flags |= MAP_EXECUTABLE;
+        }
+
+        if((_flags & MappingFlags::POPULATE) == MappingFlags::POPULATE) {
+            map_flags |= MAP_POPULATE;
+        }
+
+        auto* address = KSTD_MMAP(nullptr, size, prot, map_flags, _file.get_handle(), 0);
 
-            ::munmap(_address, size);
+        if(address == MAP_FAILED) {
+            return Error {fmt::format("Could not map file {}: {}", _file.get_path().string(), get_last_error())};
         }
+
+        return address;
     }
 
-    auto FileMapping::resize(usize size) noexcept -> Result<void> {
-        return _file.resize(size);
+    FileMapping::~FileMapping() noexcept {
+        _write_tracker = WriteTracker {};
+
+        if(_address != nullptr) {
+            ::munmap(_address, _size);
+        }
     }
 
-    auto FileMapping::sync() noexcept -> Result<void> {
-        auto size_result = _file.get_size();
+    auto FileMapping::resize(usize size) noexcept -> Result<void> {
+        if((_flags & MappingFlags::PRIVATE) == MappingFlags::PRIVATE) {
+            return Error {fmt::format("Could not resize mapping of {}: private mappings never change the file",
+                                      _file.get_path().string())};
+        }
+
+        size = std::max<usize>(size, 1);// Like the constructor, always map at least one byte
 
-        if(!size_result) {
-            return size_result.forward<void>();
+        if(auto result = _file.resize(size); !result || _address == nullptr) {
+            return result;
         }
 
-        if(::msync(_address, *size_result, MS_SYNC) != 0) {
-            return Error {fmt::format("Could not sync mapping: {}", get_last_error())};
+        const auto is_tracking = is_write_tracking();
+        _write_tracker = WriteTracker {};// Its protected region refers to the old address and size
+        auto* address = ::mremap(_address, _size, size, MREMAP_MAYMOVE);
+
+        if(address == MAP_FAILED) {
+            const auto error = get_last_error();
+            static_cast<void>(set_write_tracking(is_tracking));
+            return Error {fmt::format("Could not remap file {}: {}", _file.get_path().string(), error)};
         }
 
-        return {};
+        return rebind(address, size, is_tracking);
+    }
+
+    auto FileMapping::sync() noexcept -> Result<void> {
+        return sync({0, _size});
     }
 
     auto FileMapping::get_type() const noexcept -> MappingType {
@@ -148,6 +184,10 @@ namespace kstd::platform::mm {
     auto FileMapping::get_address() const noexcept -> void* {
         return _address;
     }
+
+    auto FileMapping::get_size() const noexcept -> usize {
+        return _size;
+    }
 }// namespace kstd::platform::mm
 
 #endif// PLATFORM_LINUX
\ No newline at end of file
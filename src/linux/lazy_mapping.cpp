@@ -0,0 +1,315 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/lazy_mapping.hpp"
+#include "kstd/platform/platform.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/userfaultfd.h>
+#include <csignal>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+#ifndef UFFD_USER_MODE_ONLY
+#define UFFD_USER_MODE_ONLY 1
+#endif
+
+namespace kstd::platform::mm {
+    struct LazyMappingState final {
+        int fd;
+        int stop_fd;
+        u8* address;
+        usize page_size;
+        u8* buffer;
+        PageProvider provider;
+        std::thread thread;
+        std::atomic<usize> fault_count;
+        std::atomic<usize> zero_page_count;
+        std::atomic<usize> failed_fault_count;
+        std::atomic<u64> total_latency;
+        std::atomic<u64> max_latency;
+
+        LazyMappingState(u8* address, PageProvider provider) :
+                fd {-1},
+                stop_fd {-1},
+                address {address},
+                page_size {get_page_size()},
+                buffer {nullptr},
+                provider {std::move(provider)},
+                fault_count {0},
+                zero_page_count {0},
+                failed_fault_count {0},
+                total_latency {0},
+                max_latency {0} {
+        }
+
+        ~LazyMappingState() noexcept {
+            if(thread.joinable()) {
+                const u64 value = 1;
+                static_cast<void>(::write(stop_fd, &value, sizeof(value)));
+                thread.join();
+            }
+
+            if(buffer != nullptr) {
+                ::munmap(buffer, page_size);
+            }
+
+            if(stop_fd != -1) {
+                ::close(stop_fd);
+            }
+
+            if(fd != -1) {
+                ::close(fd);
+            }
+        }
+
+        KSTD_NO_COPY(LazyMappingState, LazyMappingState)
+
+        [[nodiscard]] auto populate(usize offset, u64 page_address) noexcept -> bool {
+            auto result = provider(offset, buffer, page_size);
+
+            if(!result) {
+                return false;
+            }
+
+            auto status = 0;
+
+            if(*result == PageContent::DATA) {
+                const auto source = reinterpret_cast<u64>(buffer);// NOLINT
+                uffdio_copy copy {page_address, source, page_size, UFFDIO_COPY_MODE_DONTWAKE, 0};
+                status = ::ioctl(fd, UFFDIO_COPY, &copy);
+            }
+            else {
+                uffdio_zeropage zero_page {{page_address, page_size}, UFFDIO_ZEROPAGE_MODE_DONTWAKE, 0};
+                status = ::ioctl(fd, UFFDIO_ZEROPAGE, &zero_page);
+                zero_page_count.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // EEXIST means the page was populated some other way in the meantime, which is just as good
+            return status == 0 || errno == EEXIST;
+        }
+
+        auto resolve(u64 fault_address, u32 thread_id) noexcept -> void {
+            const auto start = std::chrono::steady_clock::now();
+            const auto page_address = fault_address & ~static_cast<u64>(page_size - 1);
+            const auto offset = static_cast<usize>(page_address - reinterpret_cast<u64>(address));// NOLINT
+            const auto is_populated = populate(offset, page_address);
+
+            if(!is_populated) {
+                failed_fault_count.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            const auto latency = static_cast<u64>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+                            .count());
+            total_latency.fetch_add(latency, std::memory_order_relaxed);
+            auto max = max_latency.load(std::memory_order_relaxed);
+
+            while(latency > max && !max_latency.compare_exchange_weak(max, latency, std::memory_order_relaxed)) {
+            }
+
+            // The faulting thread is only woken once the statistics are updated, so it always observes its own fault
+            fault_count.fetch_add(1, std::memory_order_relaxed);
+
+            if(!is_populated) {
+                // Like a file mapping past the end of its file, the signal interrupts the fault
+                ::syscall(SYS_tgkill, ::getpid(), thread_id, SIGBUS);
+                return;
+            }
+
+            uffdio_range range {page_address, page_size};
+            ::ioctl(fd, UFFDIO_WAKE, &range);
+        }
+
+        auto run() noexcept -> void {
+            pollfd fds[2] {{fd, POLLIN, 0}, {stop_fd, POLLIN, 0}};// NOLINT
+
+            while(true) {
+                if(::poll(fds, 2, -1) < 0) {
+                    if(errno == EINTR) {
+                        continue;
+                    }
+                    break;
+                }
+
+                if((fds[1].revents & POLLIN) != 0) {
+                    break;
+                }
+
+                uffd_msg message {};
+
+                if(::read(fd, &message, sizeof(message)) != sizeof(message)) {
+                    if(errno == EAGAIN || errno == EINTR) {
+                        continue;
+                    }
+                    break;
+                }
+
+                if(message.event == UFFD_EVENT_PAGEFAULT) {
+                    resolve(message.arg.pagefault.address, message.arg.pagefault.feat.ptid);
+                }
+            }
+        }
+    };
+
+    LazyMapping::LazyMapping(LazyMapping&& other) noexcept :
+            _state {std::move(other._state)},
+            _address {other._address},
+            _size {other._size},
+            _access {other._access} {
+        other._address = nullptr;
+        other._size = 0;
+    }
+
+    LazyMapping::LazyMapping() noexcept :
+            _address {nullptr},
+            _size {0},
+            _access {MappingAccess::NONE} {
+    }
+
+    LazyMapping::LazyMapping(usize size, PageProvider provider, MappingAccess access) :
+            _address {nullptr},
+            _size {MappingRange {0, size}.align_to(get_page_size()).size},
+            _access {access} {
+        if(_size == 0) {
+            throw std::runtime_error {"Could not create lazy mapping: size must not be zero"};
+        }
+
+        auto protection = PROT_NONE;
+
+        if((_access & MappingAccess::READ) == MappingAccess::READ) {
+            protection |= PROT_READ;
+        }
+
+        if((_access & MappingAccess::WRITE) == MappingAccess::WRITE) {
+            protection |= PROT_WRITE;
+        }
+
+        auto* address = ::mmap(nullptr, _size, protection, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+        if(address == MAP_FAILED) {
+            throw std::runtime_error {fmt::format("Could not create lazy mapping: {}", get_last_error())};
+        }
+
+        _address = static_cast<u8*>(address);
+        _state = std::make_unique<LazyMappingState>(_address, std::move(provider));
+
+        // Unprivileged processes may only handle faults from user space, which is all we need
+        _state->fd = static_cast<int>(::syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY));
+
+        if(_state->fd == -1 && errno == EINVAL) {
+            _state->fd = static_cast<int>(::syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK));
+        }
+
+        if(_state->fd == -1) {
+            const auto error = get_last_error();
+            _state.reset();
+            ::munmap(_address, _size);
+            throw std::runtime_error {fmt::format("Could not create userfaultfd: {}", error)};
+        }
+
+        uffdio_api api {UFFD_API, UFFD_FEATURE_THREAD_ID, 0};// Failed faults are signalled to their thread
+        const auto range = uffdio_range {reinterpret_cast<u64>(_address), _size};// NOLINT
+        uffdio_register registration {range, UFFDIO_REGISTER_MODE_MISSING, 0};
+        auto* buffer = ::mmap(nullptr, _state->page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        _state->buffer = buffer == MAP_FAILED ? nullptr : static_cast<u8*>(buffer);
+        _state->stop_fd = ::eventfd(0, EFD_CLOEXEC);
+
+        if(::ioctl(_state->fd, UFFDIO_API, &api) != 0 || ::ioctl(_state->fd, UFFDIO_REGISTER, &registration) != 0 ||
+           _state->buffer == nullptr || _state->stop_fd == -1) {
+            const auto error = get_last_error();
+            _state.reset();
+            ::munmap(_address, _size);
+            throw std::runtime_error {fmt::format("Could not register lazy mapping: {}", error)};
+        }
+
+        _state->thread = std::thread {[state = _state.get()] { state->run(); }};
+    }
+
+    LazyMapping::~LazyMapping() noexcept {
+        _state.reset();// Stops the handler before its range goes away
+
+        if(_address != nullptr) {
+            ::munmap(_address, _size);
+        }
+    }
+
+    auto LazyMapping::operator=(LazyMapping&& other) noexcept -> LazyMapping& {
+        if(this == &other) {
+            return *this;
+        }
+
+        LazyMapping previous {std::move(*this)};// Releases our current mapping at the end of the scope
+        _state = std::move(other._state);
+        _address = other._address;
+        _size = other._size;
+        _access = other._access;
+        other._address = nullptr;
+        other._size = 0;
+        return *this;
+    }
+
+    auto LazyMapping::resize([[maybe_unused]] usize size) noexcept -> Result<void> {
+        return Error {std::string("Could not resize lazy mapping: lazy mappings have a fixed size")};
+    }
+
+    auto LazyMapping::sync() noexcept -> Result<void> {
+        return {};// Lazy mappings are not backed by a file
+    }
+
+    auto LazyMapping::get_type() const noexcept -> MappingType {
+        return MappingType::LAZY;
+    }
+
+    auto LazyMapping::get_access() const noexcept -> MappingAccess {
+        return _access;
+    }
+
+    auto LazyMapping::get_address() const noexcept -> void* {
+        return _address;
+    }
+
+    auto LazyMapping::get_size() const noexcept -> usize {
+        return _size;
+    }
+
+    auto LazyMapping::get_statistics() const noexcept -> LazyMappingStatistics {
+        if(_state == nullptr) {
+            return {};
+        }
+
+        return {_state->fault_count.load(std::memory_order_relaxed),
+                _state->zero_page_count.load(std::memory_order_relaxed),
+                _state->failed_fault_count.load(std::memory_order_relaxed),
+                std::chrono::nanoseconds {_state->total_latency.load(std::memory_order_relaxed)},
+                std::chrono::nanoseconds {_state->max_latency.load(std::memory_order_relaxed)}};
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,383 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/memory_mapping.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <limits>
+#include <sys/resource.h>
+#include <vector>
+
+// Older kernel headers don't know about these yet, the kernel rejects them with EINVAL
+#ifndef MADV_COLD
+#define MADV_COLD 20
+#endif
+#ifndef MADV_PAGEOUT
+#define MADV_PAGEOUT 21
+#endif
+#ifndef MADV_POPULATE_READ
+#define MADV_POPULATE_READ 22
+#endif
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+#ifndef MLOCK_ONFAULT
+#define MLOCK_ONFAULT 0x01
+#endif
+#ifndef MCL_ONFAULT
+#define MCL_ONFAULT 4
+#endif
+
+namespace kstd::platform::mm {
+    static constexpr u64 pagemap_present_bit = u64 {1} << 63;
+    static constexpr u64 pagemap_swapped_bit = u64 {1} << 62;
+    static constexpr u64 pagemap_file_bit = u64 {1} << 61;
+    static constexpr usize pagemap_batch_size = 512;
+    static constexpr u64 ipc_lock_capability_bit = u64 {1} << 14;// CAP_IPC_LOCK
+
+    struct LockStatus final {
+        usize locked_size;
+        usize mapped_size;
+        bool is_exempt;
+    };
+
+    // Reads how much memory is locked and mapped, and whether the lock limit applies to us at all
+    [[nodiscard]] static auto get_lock_status() noexcept -> Result<LockStatus> {
+        auto* stream = std::fopen("/proc/self/status", "re");
+
+        if(stream == nullptr) {
+            return Error {fmt::format("Could not read process status: {}", get_last_error())};
+        }
+
+        LockStatus status {0, 0, false};
+        std::array<char, 256> line {};
+
+        while(std::fgets(line.data(), static_cast<int>(line.size()), stream) != nullptr) {
+            unsigned long long value = 0;// NOLINT
+
+            if(std::sscanf(line.data(), "VmLck: %llu kB", &value) == 1) {// NOLINT
+                status.locked_size = static_cast<usize>(value) << 10U;
+            }
+            else if(std::sscanf(line.data(), "VmSize: %llu kB", &value) == 1) {// NOLINT
+                status.mapped_size = static_cast<usize>(value) << 10U;
+            }
+            else if(std::sscanf(line.data(), "CapEff: %llx", &value) == 1) {// NOLINT
+                status.is_exempt = (static_cast<u64>(value) & ipc_lock_capability_bit) != 0;
+            }
+        }
+
+        std::fclose(stream);
+        return status;
+    }
+
+    // Checks whether size more bytes may be locked, unless they already include what is locked
+    [[nodiscard]] static auto check_lock_limit(usize size, bool includes_locked = false) noexcept -> Result<void> {
+        const auto limit = get_lock_limit();
+
+        if(!limit) {
+            return limit.forward<void>();
+        }
+
+        if(*limit == std::numeric_limits<usize>::max()) {
+            return {};
+        }
+
+        const auto status = get_lock_status();
+
+        if(!status) {
+            return status.forward<void>();
+        }
+
+        const auto locked_size = includes_locked ? 0 : status->locked_size;
+
+        if(!status->is_exempt && (size > *limit || locked_size > *limit - size)) {
+            return Error {fmt::format("Could not lock {} bytes: exceeds RLIMIT_MEMLOCK of {} bytes, {} are locked",
+                                      size, *limit, status->locked_size)};
+        }
+
+        return {};
+    }
+
+    auto get_lock_limit() noexcept -> Result<usize> {
+        rlimit limit {};
+
+        if(::getrlimit(RLIMIT_MEMLOCK, &limit) != 0) {
+            return Error {fmt::format("Could not get lock limit: {}", get_last_error())};
+        }
+
+        if(limit.rlim_cur == RLIM_INFINITY) {
+            return std::numeric_limits<usize>::max();
+        }
+
+        return static_cast<usize>(limit.rlim_cur);
+    }
+
+    auto lock_process_memory(ProcessLockFlags flags) noexcept -> Result<void> {
+        i32 native_flags = 0;
+
+        if((flags & ProcessLockFlags::CURRENT) == ProcessLockFlags::CURRENT) {
+            const auto status = get_lock_status();
+
+            if(!status) {
+                return status.forward<void>();
+            }
+
+            // Everything mapped is about to be locked, which includes whatever is locked already
+            if(auto result = check_lock_limit(status->mapped_size, true); !result) {
+                return result;
+            }
+
+            native_flags |= MCL_CURRENT;
+        }
+
+        if((flags & ProcessLockFlags::FUTURE) == ProcessLockFlags::FUTURE) {
+            native_flags |= MCL_FUTURE;
+        }
+
+        if((flags & ProcessLockFlags::ON_FAULT) == ProcessLockFlags::ON_FAULT) {
+            native_flags |= MCL_ONFAULT;
+        }
+
+        if(::mlockall(native_flags) != 0) {
+            return Error {fmt::format("Could not lock process memory: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto unlock_process_memory() noexcept -> Result<void> {
+        if(::munlockall() != 0) {
+            return Error {fmt::format("Could not unlock process memory: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::advise(MappingRange range, MappingAdvice advice) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not advise mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        i32 native_advice = MADV_NORMAL;
+
+        switch(advice) {
+            case MappingAdvice::NORMAL: native_advice = MADV_NORMAL; break;
+            case MappingAdvice::SEQUENTIAL: native_advice = MADV_SEQUENTIAL; break;
+            case MappingAdvice::RANDOM: native_advice = MADV_RANDOM; break;
+            case MappingAdvice::WILL_NEED: native_advice = MADV_WILLNEED; break;
+            case MappingAdvice::DONT_NEED: native_advice = MADV_DONTNEED; break;
+            case MappingAdvice::COLD: native_advice = MADV_COLD; break;
+            case MappingAdvice::PAGE_OUT: native_advice = MADV_PAGEOUT; break;
+            case MappingAdvice::POPULATE_READ: native_advice = MADV_POPULATE_READ; break;
+            case MappingAdvice::POPULATE_WRITE: native_advice = MADV_POPULATE_WRITE; break;
+        }
+
+        const auto page_size = get_page_size();
+        const auto is_reclaiming = advice == MappingAdvice::DONT_NEED || advice == MappingAdvice::COLD ||
+                                   advice == MappingAdvice::PAGE_OUT;
+        // Rounding outward would drop the bytes around the range from private pages
+        const auto aligned_range = is_reclaiming ? range.shrink_to(page_size, get_size()) : range.align_to(page_size);
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(aligned_range.size == 0) {
+            return {};
+        }
+
+        if(::madvise(address, aligned_range.size, native_advice) == 0) {
+            return {};
+        }
+
+        const auto is_readable = (get_access() & MappingAccess::READ) == MappingAccess::READ;
+
+        if(errno == EINVAL && advice == MappingAdvice::POPULATE_READ && is_readable) {
+            // Kernels before 5.14 don't support MADV_POPULATE_READ, so we fault every page in by hand
+            for(usize offset = 0; offset < aligned_range.size; offset += page_size) {
+                static_cast<void>(*static_cast<volatile u8*>(address + offset));// NOLINT
+            }
+
+            return {};
+        }
+
+        return Error {fmt::format("Could not advise mapping: {}", get_last_error())};
+    }
+
+    auto MemoryMapping::sync(MappingRange range, SyncFlags flags) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not sync mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        i32 native_flags = (flags & SyncFlags::ASYNC) == SyncFlags::ASYNC ? MS_ASYNC : MS_SYNC;
+
+        if((flags & SyncFlags::INVALIDATE) == SyncFlags::INVALIDATE) {
+            native_flags |= MS_INVALIDATE;
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(::msync(address, aligned_range.size, native_flags) != 0) {
+            return Error {fmt::format("Could not sync mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::protect(MappingRange range, MappingAccess access) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not protect mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        i32 prot = PROT_NONE;
+
+        if((access & MappingAccess::READ) == MappingAccess::READ) {
+            prot |= PROT_READ;
+        }
+
+        if((access & MappingAccess::WRITE) == MappingAccess::WRITE) {
+            prot |= PROT_WRITE;
+        }
+
+        if((access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE) {
+            prot |= PROT_EXEC;
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(::mprotect(address, aligned_range.size, prot) != 0) {
+            return Error {fmt::format("Could not protect mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::lock(MappingRange range, LockFlags flags) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not lock mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(auto result = check_lock_limit(aligned_range.size); !result) {
+            return result;
+        }
+
+        const auto is_on_fault = (flags & LockFlags::ON_FAULT) == LockFlags::ON_FAULT;
+
+        if(::mlock2(address, aligned_range.size, is_on_fault ? MLOCK_ONFAULT : 0) != 0) {
+            return Error {fmt::format("Could not lock mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::unlock(MappingRange range) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not unlock mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(::munlock(address, aligned_range.size) != 0) {
+            return Error {fmt::format("Could not unlock mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::get_private_page_count() const noexcept -> Result<usize> {
+        const auto page_size = get_page_size();
+        const auto first_page = reinterpret_cast<uintptr_t>(get_address()) / page_size;// NOLINT
+        const auto page_count = (get_size() + page_size - 1) / page_size;
+        const auto handle = ::open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+
+        if(handle == invalid_file_handle) {
+            return Error {fmt::format("Could not open page map: {}", get_last_error())};
+        }
+
+        // Pages which were copied on write are anonymous, so they lose the file-page bit
+        std::array<u64, pagemap_batch_size> entries {};
+        usize private_page_count = 0;
+
+        for(usize page = 0; page < page_count; page += pagemap_batch_size) {
+            const auto batch_size = std::min(pagemap_batch_size, page_count - page);
+            const auto offset = static_cast<NativeOffset>((first_page + page) * sizeof(u64));
+            const isize read_size = ::pread(handle, entries.data(), batch_size * sizeof(u64), offset);
+
+            // A short read leaves stale entries of the previous batch behind, so it is an error as well
+            if(read_size != static_cast<isize>(batch_size * sizeof(u64))) {
+                const auto error = read_size < 0 ? get_last_error() : fmt::format("read only {} bytes", read_size);
+                ::close(handle);
+                return Error {fmt::format("Could not read page map: {}", error)};
+            }
+
+            for(usize index = 0; index < batch_size; ++index) {
+                const auto entry = entries[index];
+                const auto is_mapped = (entry & (pagemap_present_bit | pagemap_swapped_bit)) != 0;
+
+                if(is_mapped && (entry & pagemap_file_bit) == 0) {
+                    ++private_page_count;
+                }
+            }
+        }
+
+        ::close(handle);
+        return private_page_count;
+    }
+
+    auto MemoryMapping::get_residency(MappingRange range) const noexcept -> Result<PageResidency> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not query residency: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto page_size = get_page_size();
+        const auto aligned_range = range.align_to(page_size);
+        const auto page_count = aligned_range.size / page_size;
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        std::vector<unsigned char> pages(page_count);
+
+        if(page_count > 0 && ::mincore(address, aligned_range.size, pages.data()) != 0) {
+            return Error {fmt::format("Could not query residency: {}", get_last_error())};
+        }
+
+        PageResidency residency {page_size, page_count};
+
+        for(usize page = 0; page < page_count; ++page) {
+            if((pages[page] & 1U) != 0) {
+                residency.mark_resident(page);
+            }
+        }
+
+        return residency;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,189 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/numa.hpp"
+#include "kstd/platform/memory_mapping.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/syscall.h>
+
+// Values from linux/mempolicy.h, which isn't always installed
+#define KSTD_MPOL_DEFAULT 0
+#define KSTD_MPOL_PREFERRED 1
+#define KSTD_MPOL_BIND 2
+#define KSTD_MPOL_INTERLEAVE 3
+#define KSTD_MPOL_LOCAL 4
+#define KSTD_MPOL_MF_MOVE (1U << 1U)
+
+namespace kstd::platform {
+    static constexpr usize bits_per_mask_word = sizeof(unsigned long) << 3;// NOLINT
+
+    struct NodeMask final {
+        std::vector<unsigned long> words;// NOLINT
+        unsigned long max_node;          // NOLINT
+    };
+
+    [[nodiscard]] static auto read_highest_node() noexcept -> usize {
+        // The online list looks like "0-1,3", only its highest node matters
+        std::ifstream stream("/sys/devices/system/node/online");
+        std::string list {};
+
+        if(!stream || !std::getline(stream, list) || list.empty()) {
+            return 0;
+        }
+
+        const auto separator = list.find_last_of(",-");
+        const auto last_node = separator == std::string::npos ? list : list.substr(separator + 1);
+        return static_cast<usize>(std::strtoul(last_node.c_str(), nullptr, 10));
+    }
+
+    [[nodiscard]] static auto to_native_policy(NumaPolicy policy) noexcept -> i32 {
+        switch(policy) {
+            case NumaPolicy::LOCAL: return KSTD_MPOL_LOCAL;
+            case NumaPolicy::BIND: return KSTD_MPOL_BIND;
+            case NumaPolicy::PREFERRED: return KSTD_MPOL_PREFERRED;
+            case NumaPolicy::INTERLEAVE: return KSTD_MPOL_INTERLEAVE;
+            default: return KSTD_MPOL_DEFAULT;
+        }
+    }
+
+    [[nodiscard]] static auto to_node_mask(const std::vector<u32>& nodes) noexcept -> NodeMask {
+        if(nodes.empty()) {
+            return {{}, 0};
+        }
+
+        const auto highest_node = *std::max_element(nodes.cbegin(), nodes.cend());
+        NodeMask mask {std::vector<unsigned long>(highest_node / bits_per_mask_word + 1), 0};
+
+        for(const auto node : nodes) {
+            mask.words[node / bits_per_mask_word] |= 1UL << (node % bits_per_mask_word);
+        }
+
+        // The kernel ignores the last bit of maxnode, so pass one more than the mask holds
+        mask.max_node = static_cast<unsigned long>(mask.words.size() * bits_per_mask_word + 1);
+        return mask;
+    }
+
+    auto get_numa_node_count() noexcept -> usize {
+        static const auto node_count = read_highest_node() + 1;
+        return node_count;
+    }
+
+    auto set_thread_numa_policy(NumaPolicy policy, const std::vector<u32>& nodes) noexcept -> Result<void> {
+        if(auto result = validate_numa_policy(policy, nodes); !result) {
+            return result;
+        }
+
+        if(get_numa_node_count() < 2) {
+            return {};
+        }
+
+        const auto mask = to_node_mask(nodes);
+        const auto* mask_data = mask.words.empty() ? nullptr : mask.words.data();
+
+        if(::syscall(SYS_set_mempolicy, to_native_policy(policy), mask_data, mask.max_node) != 0) {
+            return Error {fmt::format("Could not set thread NUMA policy: {}", get_last_error())};
+        }
+
+        return {};
+    }
+}// namespace kstd::platform
+
+namespace kstd::platform::mm {
+    auto MemoryMapping::set_numa_policy(MappingRange range, NumaPolicy policy, const std::vector<u32>& nodes,
+                                        bool move_existing) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not set NUMA policy: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        if(auto result = validate_numa_policy(policy, nodes); !result) {
+            return result;
+        }
+
+        // With a single node every page already lands where any policy would put it
+        if(get_numa_node_count() < 2 || range.size == 0) {
+            return {};
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        const auto mask = to_node_mask(nodes);
+        const auto* mask_data = mask.words.empty() ? nullptr : mask.words.data();
+        const auto flags = move_existing ? KSTD_MPOL_MF_MOVE : 0U;
+
+        if(::syscall(SYS_mbind, address, aligned_range.size, to_native_policy(policy), mask_data, mask.max_node,
+                     flags) != 0) {
+            return Error {fmt::format("Could not set NUMA policy: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::get_numa_nodes(MappingRange range) const noexcept -> Result<std::vector<i32>> {
+        if(get_numa_node_count() < 2) {
+            auto residency = get_residency(range);
+
+            if(!residency) {
+                return residency.forward<std::vector<i32>>();
+            }
+
+            std::vector<i32> nodes(residency->get_page_count(), -ENOENT);
+
+            for(usize page = 0; page < nodes.size(); ++page) {
+                if(residency->is_resident(page)) {
+                    nodes[page] = 0;
+                }
+            }
+
+            return nodes;
+        }
+
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not query NUMA nodes: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto page_size = get_page_size();
+        const auto aligned_range = range.align_to(page_size);
+        const auto page_count = aligned_range.size / page_size;
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        std::vector<void*> pages(page_count);
+        std::vector<i32> nodes(page_count);
+
+        for(usize page = 0; page < page_count; ++page) {
+            pages[page] = address + page * page_size;// NOLINT
+        }
+
+        // Without target nodes move_pages only reports where each page currently is
+        if(page_count > 0 && ::syscall(SYS_move_pages, 0, page_count, pages.data(), nullptr, nodes.data(), 0) != 0) {
+            return Error {fmt::format("Could not query NUMA nodes: {}", get_last_error())};
+        }
+
+        return nodes;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_LINUX
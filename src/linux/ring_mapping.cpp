@@ -0,0 +1,142 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/ring_mapping.hpp"
+
+#include <sys/mman.h>
+
+namespace kstd::platform::mm {
+    RingMapping::RingMapping(RingMapping&& other) noexcept :
+            _mode {other._mode},
+            _address {other._address},
+            _size {other._size},
+            _handle {other._handle},
+            _cursors {std::move(other._cursors)} {
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+    }
+
+    RingMapping::RingMapping() noexcept :
+            _mode {RingMode::SINGLE_PRODUCER},
+            _address {nullptr},
+            _size {0},
+            _handle {invalid_file_handle} {
+    }
+
+    RingMapping::RingMapping(usize size, RingMode mode) :
+            _mode {mode},
+            _address {nullptr},
+            _size {MappingRange {0, size}.align_to(get_page_size()).size},
+            _handle {invalid_file_handle},
+            _cursors {std::make_unique<RingCursors>()} {
+        if(_size == 0) {
+            throw std::runtime_error {"Could not create ring mapping: size must not be zero"};
+        }
+
+        _handle = ::memfd_create("kstd-ring", MFD_CLOEXEC);
+
+        if(!_handle.is_valid()) {
+            throw std::runtime_error {fmt::format("Could not create ring memory: {}", get_last_error())};
+        }
+
+        if(::ftruncate(_handle, static_cast<NativeOffset>(_size)) != 0) {
+            const auto error = get_last_error();
+            ::close(_handle);
+            throw std::runtime_error {fmt::format("Could not resize ring memory: {}", error)};
+        }
+
+        // Reserve twice the size, then map the same memory into both halves of the reservation
+        auto* address = static_cast<u8*>(::mmap(nullptr, _size << 1, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+        if(address == MAP_FAILED) {
+            const auto error = get_last_error();
+            ::close(_handle);
+            throw std::runtime_error {fmt::format("Could not reserve ring address space: {}", error)};
+        }
+
+        constexpr auto prot = PROT_READ | PROT_WRITE;
+        constexpr auto map_flags = MAP_SHARED | MAP_FIXED;
+
+        if(::mmap(address, _size, prot, map_flags, _handle, 0) == MAP_FAILED ||
+           ::mmap(address + _size, _size, prot, map_flags, _handle, 0) == MAP_FAILED) {// NOLINT
+            const auto error = get_last_error();
+            ::munmap(address, _size << 1);
+            ::close(_handle);
+            throw std::runtime_error {fmt::format("Could not map ring memory: {}", error)};
+        }
+
+        _address = address;
+    }
+
+    RingMapping::~RingMapping() noexcept {
+        if(_address != nullptr) {
+            ::munmap(_address, _size << 1);
+        }
+
+        if(_handle.is_valid()) {
+            ::close(_handle);
+        }
+    }
+
+    auto RingMapping::operator=(RingMapping&& other) noexcept -> RingMapping& {
+        if(this == &other) {
+            return *this;
+        }
+
+        RingMapping previous {std::move(*this)};// Releases our current ring at the end of the scope
+        _mode = other._mode;
+        _address = other._address;
+        _size = other._size;
+        _handle = other._handle;
+        _cursors = std::move(other._cursors);
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+        return *this;
+    }
+
+    auto RingMapping::resize([[maybe_unused]] usize size) noexcept -> Result<void> {
+        return Error {std::string("Could not resize ring mapping: rings have a fixed size")};
+    }
+
+    auto RingMapping::sync() noexcept -> Result<void> {
+        return {};// Rings are not backed by a file, so there is nothing to write back
+    }
+
+    auto RingMapping::get_type() const noexcept -> MappingType {
+        return MappingType::RING;
+    }
+
+    auto RingMapping::get_access() const noexcept -> MappingAccess {
+        return MappingAccess::READ | MappingAccess::WRITE;
+    }
+
+    auto RingMapping::get_address() const noexcept -> void* {
+        return _address;
+    }
+
+    auto RingMapping::get_size() const noexcept -> usize {
+        return _size;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,240 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/shared_mapping.hpp"
+
+#include <chrono>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+
+namespace kstd::platform::mm {
+    static constexpr usize size_wait_attempts = 100;
+
+    [[nodiscard]] static auto get_object_name(const std::string& name) noexcept -> std::string {
+        return name.empty() || name.front() == '/' ? name : fmt::format("/{}", name);
+    }
+
+    [[nodiscard]] static auto get_native_protection(MappingAccess access) noexcept -> i32 {
+        i32 prot = PROT_NONE;
+
+        if((access & MappingAccess::READ) == MappingAccess::READ) {
+            prot |= PROT_READ;
+        }
+
+        if((access & MappingAccess::WRITE) == MappingAccess::WRITE) {
+            prot |= PROT_WRITE;
+        }
+
+        return prot;
+    }
+
+    SharedMapping::SharedMapping(SharedMapping&& other) noexcept :
+            _name {std::move(other._name)},
+            _access {other._access},
+            _address {other._address},
+            _size {other._size},
+            _handle {other._handle},
+            _is_owner {other._is_owner} {
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+        other._is_owner = false;
+    }
+
+    SharedMapping::SharedMapping() noexcept :
+            _access {MappingAccess::NONE},
+            _address {nullptr},
+            _size {0},
+            _handle {invalid_file_handle},
+            _is_owner {false} {
+    }
+
+    SharedMapping::SharedMapping(std::string name, MappingAccess access, SharedMode mode, usize size) :
+            _name {get_object_name(name)},
+            _access {access},
+            _address {nullptr},
+            _size {0},
+            _handle {invalid_file_handle},
+            _is_owner {false} {
+        const auto is_writable = (_access & MappingAccess::WRITE) == MappingAccess::WRITE;
+        const auto open_flags = is_writable ? O_RDWR : O_RDONLY;
+
+        if(mode == SharedMode::CREATE && size == 0) {
+            throw std::runtime_error {fmt::format("Could not create shared memory {}: size must not be zero", _name)};
+        }
+
+        // Without a size we can only open an existing region
+        if(mode != SharedMode::OPEN && size != 0) {
+            _handle = ::shm_open(_name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+            _is_owner = _handle.is_valid();
+
+            if(!_is_owner && (mode == SharedMode::CREATE || errno != EEXIST)) {
+                throw std::runtime_error {
+                        fmt::format("Could not create shared memory {}: {}", _name, get_last_error())};
+            }
+        }
+
+        if(_is_owner) {
+            if(::ftruncate(_handle, static_cast<NativeOffset>(size)) != 0) {
+                const auto error = get_last_error();
+                ::close(_handle);
+                ::shm_unlink(_name.c_str());
+                throw std::runtime_error {fmt::format("Could not create shared memory {}: {}", _name, error)};
+            }
+
+            _size = size;
+        }
+        else {
+            _handle = ::shm_open(_name.c_str(), open_flags, 0);
+
+            if(!_handle.is_valid()) {
+                throw std::runtime_error {fmt::format("Could not open shared memory {}: {}", _name, get_last_error())};
+            }
+
+            struct stat stats {};
+            auto status = ::fstat(_handle, &stats);
+
+            // The creator sizes the region right after creating it, which may not have happened yet
+            for(usize attempt = 0; status == 0 && stats.st_size == 0 && attempt < size_wait_attempts; ++attempt) {
+                std::this_thread::sleep_for(std::chrono::milliseconds {1});
+                status = ::fstat(_handle, &stats);
+            }
+
+            if(status != 0 || stats.st_size == 0 || static_cast<usize>(stats.st_size) < size) {
+                ::close(_handle);
+                throw std::runtime_error {fmt::format("Could not open shared memory {}: size {} is not available",
+                                                      _name, size)};
+            }
+
+            _size = static_cast<usize>(stats.st_size);
+        }
+
+        _address = ::mmap(nullptr, _size, get_native_protection(_access), MAP_SHARED, _handle, 0);
+
+        if(_address == MAP_FAILED) {
+            const auto error = get_last_error();
+            _address = nullptr;
+            ::close(_handle);
+
+            if(_is_owner) {
+                ::shm_unlink(_name.c_str());
+            }
+
+            throw std::runtime_error {fmt::format("Could not map shared memory {}: {}", _name, error)};
+        }
+    }
+
+    SharedMapping::SharedMapping(file::FileHandle handle, MappingAccess access) :
+            _access {access},
+            _address {nullptr},
+            _size {0},
+            _handle {handle},
+            _is_owner {false} {
+        struct stat stats {};
+
+        // We own the handle, so it has to be closed when we throw, since no destructor will run
+        if(::fstat(_handle, &stats) != 0) {
+            const auto error = get_last_error();
+            ::close(_handle);
+            throw std::runtime_error {fmt::format("Could not retrieve shared memory size: {}", error)};
+        }
+
+        _size = static_cast<usize>(stats.st_size);
+        _address = ::mmap(nullptr, _size, get_native_protection(_access), MAP_SHARED, _handle, 0);
+
+        if(_address == MAP_FAILED) {
+            const auto error = get_last_error();
+            _address = nullptr;
+            ::close(_handle);
+            throw std::runtime_error {fmt::format("Could not map shared memory: {}", error)};
+        }
+    }
+
+    SharedMapping::~SharedMapping() noexcept {
+        if(_address != nullptr) {
+            ::munmap(_address, _size);
+        }
+
+        if(_handle.is_valid()) {
+            ::close(_handle);
+        }
+
+        if(_is_owner) {
+            ::shm_unlink(_name.c_str());
+        }
+    }
+
+    auto SharedMapping::operator=(SharedMapping&& other) noexcept -> SharedMapping& {
+        if(this == &other) {
+            return *this;
+        }
+
+        SharedMapping previous {std::move(*this)};// Releases our current mapping at the end of the scope
+        _name = std::move(other._name);
+        _access = other._access;
+        _address = other._address;
+        _size = other._size;
+        _handle = other._handle;
+        _is_owner = other._is_owner;
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+        other._is_owner = false;
+        return *this;
+    }
+
+    auto SharedMapping::unlink(const std::string& name) noexcept -> Result<void> {
+        const auto object_name = get_object_name(name);
+
+        if(::shm_unlink(object_name.c_str()) != 0) {
+            return Error {fmt::format("Could not unlink shared memory {}: {}", object_name, get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto SharedMapping::resize([[maybe_unused]] usize size) noexcept -> Result<void> {
+        return Error {fmt::format("Could not resize shared memory {}: size is fixed by its creator", _name)};
+    }
+
+    auto SharedMapping::sync() noexcept -> Result<void> {
+        return {};// Shared memory is not backed by a file, so there is nothing to write back
+    }
+
+    auto SharedMapping::get_type() const noexcept -> MappingType {
+        return MappingType::SHARED;
+    }
+
+    auto SharedMapping::get_access() const noexcept -> MappingAccess {
+        return _access;
+    }
+
+    auto SharedMapping::get_address() const noexcept -> void* {
+        return _address;
+    }
+
+    auto SharedMapping::get_size() const noexcept -> usize {
+        return _size;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_LINUX
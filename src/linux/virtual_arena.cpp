@@ -0,0 +1,165 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/virtual_arena.hpp"
+
+#include <sys/mman.h>
+
+namespace kstd::platform::mm {
+    VirtualArena::VirtualArena(VirtualArena&& other) noexcept :
+            _address {other._address},
+            _size {other._size},
+            _commit_granularity {other._commit_granularity},
+            _committed_size {other._committed_size},
+            _offset {other._offset},
+            _flags {other._flags} {
+        other._address = nullptr;
+        other._size = 0;
+        other._committed_size = 0;
+        other._offset = 0;
+    }
+
+    VirtualArena::VirtualArena() noexcept :
+            _address {nullptr},
+            _size {0},
+            _commit_granularity {0},
+            _committed_size {0},
+            _offset {0},
+            _flags {MappingFlags::NONE} {
+    }
+
+    VirtualArena::VirtualArena(usize size, usize commit_granularity, MappingFlags flags) :
+            _address {nullptr},
+            _size {MappingRange {0, size}.align_to(get_page_size()).size},
+            _commit_granularity {
+                    MappingRange {0, std::max<usize>(commit_granularity, 1)}.align_to(get_page_size()).size},
+            _committed_size {0},
+            _offset {0},
+            _flags {flags} {
+        if(_size == 0) {
+            throw std::runtime_error {"Could not create arena: size must not be zero"};
+        }
+
+        auto* address = ::mmap(nullptr, _size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+        if(address == MAP_FAILED) {
+            throw std::runtime_error {fmt::format("Could not reserve arena address space: {}", get_last_error())};
+        }
+
+        _address = static_cast<u8*>(address);
+    }
+
+    VirtualArena::~VirtualArena() noexcept {
+        if(_address != nullptr) {
+            ::munmap(_address, _size);
+        }
+    }
+
+    auto VirtualArena::operator=(VirtualArena&& other) noexcept -> VirtualArena& {
+        if(this == &other) {
+            return *this;
+        }
+
+        VirtualArena previous {std::move(*this)};// Releases our current reservation at the end of the scope
+        _address = other._address;
+        _size = other._size;
+        _commit_granularity = other._commit_granularity;
+        _committed_size = other._committed_size;
+        _offset = other._offset;
+        _flags = other._flags;
+        other._address = nullptr;
+        other._size = 0;
+        other._committed_size = 0;
+        other._offset = 0;
+        return *this;
+    }
+
+    auto VirtualArena::resize([[maybe_unused]] usize size) noexcept -> Result<void> {
+        return Error {std::string("Could not resize arena: the reservation has a fixed size")};
+    }
+
+    auto VirtualArena::sync() noexcept -> Result<void> {
+        return {};// Arenas are not backed by a file, so there is nothing to write back
+    }
+
+    auto VirtualArena::get_type() const noexcept -> MappingType {
+        return MappingType::ARENA;
+    }
+
+    auto VirtualArena::get_access() const noexcept -> MappingAccess {
+        return MappingAccess::READ | MappingAccess::WRITE;
+    }
+
+    auto VirtualArena::get_address() const noexcept -> void* {
+        return _address;
+    }
+
+    auto VirtualArena::get_size() const noexcept -> usize {
+        return _size;
+    }
+
+    auto VirtualArena::commit(usize end) noexcept -> Result<void> {
+        const auto committed_end = std::min(MappingRange {0, end}.align_to(_commit_granularity).size, _size);
+        const MappingRange range {_committed_size, committed_end - _committed_size};
+
+        if(::mprotect(_address + range.offset, range.size, PROT_READ | PROT_WRITE) != 0) {// NOLINT
+            return Error {fmt::format("Could not commit arena memory: {}", get_last_error())};
+        }
+
+        _committed_size = committed_end;
+
+        // Prefaulting is only a hint, so kernels without support for it don't fail the allocation
+        if((_flags & MappingFlags::POPULATE) == MappingFlags::POPULATE) {
+            static_cast<void>(advise(range, MappingAdvice::POPULATE_WRITE));
+        }
+
+        return {};
+    }
+
+    auto VirtualArena::decommit(DecommitMode mode) noexcept -> Result<void> {
+        const auto begin = MappingRange {0, _offset}.align_to(get_page_size()).size;
+
+        if(begin >= _committed_size) {
+            return {};
+        }
+
+        auto* address = _address + begin;// NOLINT
+        const auto size = _committed_size - begin;
+
+        if(mode == DecommitMode::LAZY) {
+            // MADV_FREE needs Linux 4.5, older kernels drop the pages right away instead
+            if(::madvise(address, size, MADV_FREE) == 0 || ::madvise(address, size, MADV_DONTNEED) == 0) {
+                return {};
+            }
+
+            return Error {fmt::format("Could not decommit arena memory: {}", get_last_error())};
+        }
+
+        if(::madvise(address, size, MADV_DONTNEED) != 0 || ::mprotect(address, size, PROT_NONE) != 0) {
+            return Error {fmt::format("Could not decommit arena memory: {}", get_last_error())};
+        }
+
+        _committed_size = begin;
+        return {};
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,201 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "kstd/platform/write_tracker.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <signal.h>
+#include <thread>
+
+namespace kstd::platform::mm {
+    static constexpr usize max_tracked_regions = 64;
+
+    // Fault handlers count themselves in while they use the region, so it is only freed once they are done
+    struct TrackedSlot final {
+        std::atomic<TrackedRegion*> region;
+        std::atomic<usize> user_count;
+    };
+
+    static std::array<TrackedSlot, max_tracked_regions> s_tracked_slots {};// NOLINT
+    static struct sigaction s_previous_action {};                          // NOLINT
+    static std::once_flag s_install_flag {};                               // NOLINT
+
+    [[nodiscard]] static auto get_native_protection(MappingAccess access, bool is_writable) noexcept -> i32 {
+        i32 prot = PROT_READ;
+
+        if(is_writable && (access & MappingAccess::WRITE) == MappingAccess::WRITE) {
+            prot |= PROT_WRITE;
+        }
+
+        if((access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE) {
+            prot |= PROT_EXEC;
+        }
+
+        return prot;
+    }
+
+    [[nodiscard]] static auto resolve_write_fault(void* address) noexcept -> bool {
+        auto* fault_address = static_cast<u8*>(address);
+
+        for(auto& slot : s_tracked_slots) {
+            ++slot.user_count;
+            const auto* region = slot.region.load();
+
+            if(region == nullptr || fault_address < region->address ||
+               fault_address >= region->address + region->size) {// NOLINT
+                --slot.user_count;
+                continue;
+            }
+
+            const auto page = static_cast<usize>(fault_address - region->address) / region->page_size;
+            constexpr usize bits_per_word = sizeof(u64) << 3;
+            region->dirty_words[page / bits_per_word].fetch_or(u64 {1} << (page % bits_per_word));// NOLINT
+
+            auto* page_address = region->address + page * region->page_size;// NOLINT
+            const auto is_writable =
+                    ::mprotect(page_address, region->page_size, get_native_protection(region->access, true)) == 0;
+            --slot.user_count;
+            return is_writable;
+        }
+
+        return false;
+    }
+
+    static auto handle_write_fault(i32 signal, siginfo_t* info, void* context) noexcept -> void {
+        const auto is_resolved = info->si_code == SEGV_ACCERR && resolve_write_fault(info->si_addr);
+
+        if(is_resolved) {
+            return;
+        }
+
+        if((s_previous_action.sa_flags & SA_SIGINFO) == SA_SIGINFO) {
+            s_previous_action.sa_sigaction(signal, info, context);
+            return;
+        }
+
+        if(s_previous_action.sa_handler == SIG_DFL || s_previous_action.sa_handler == SIG_IGN) {
+            // Returning re-executes the faulting instruction, which now triggers the default action
+            ::signal(signal, SIG_DFL);
+            return;
+        }
+
+        s_previous_action.sa_handler(signal);
+    }
+
+    static auto install_fault_handler() noexcept -> void {
+        struct sigaction action {};
+        action.sa_sigaction = handle_write_fault;
+        action.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESTART;
+        ::sigemptyset(&action.sa_mask);
+        ::sigaction(SIGSEGV, &action, &s_previous_action);
+    }
+
+    WriteTracker::WriteTracker(WriteTracker&& other) noexcept :
+            _region {std::move(other._region)} {
+    }
+
+    WriteTracker::WriteTracker() noexcept :
+            _region {} {
+    }
+
+    WriteTracker::WriteTracker(void* address, usize size, MappingAccess access, DirtyPageMap& dirty_pages) :
+            _region {std::make_unique<TrackedRegion>(TrackedRegion {static_cast<u8*>(address), size,
+                                                                    dirty_pages.get_page_size(), access,
+                                                                    dirty_pages.get_data()})} {
+        if(dirty_pages.get_size() < size) {
+            throw std::runtime_error {"Could not track writes: dirty page map is smaller than the region"};
+        }
+
+        std::call_once(s_install_flag, install_fault_handler);
+
+        const auto slot = std::find_if(s_tracked_slots.begin(), s_tracked_slots.end(), [this](auto& slot) {
+            TrackedRegion* expected = nullptr;
+            return slot.region.compare_exchange_strong(expected, _region.get());
+        });
+
+        if(slot == s_tracked_slots.end()) {
+            throw std::runtime_error {
+                    fmt::format("Could not track writes: at most {} regions can be tracked", max_tracked_regions)};
+        }
+
+        if(::mprotect(address, size, get_native_protection(access, false)) != 0) {
+            slot->region.store(nullptr);
+            throw std::runtime_error {fmt::format("Could not write-protect region: {}", get_last_error())};
+        }
+    }
+
+    WriteTracker::~WriteTracker() noexcept {
+        if(_region == nullptr) {
+            return;
+        }
+
+        // Make the region writable before unregistering it, so no write can fault without a handler
+        ::mprotect(_region->address, _region->size, get_native_protection(_region->access, true));
+
+        for(auto& slot : s_tracked_slots) {
+            auto* expected = _region.get();
+
+            if(!slot.region.compare_exchange_strong(expected, nullptr)) {
+                continue;
+            }
+
+            while(slot.user_count.load() != 0) {
+                std::this_thread::yield();// Wait for handlers which may still reference the region
+            }
+
+            break;
+        }
+    }
+
+    auto WriteTracker::operator=(WriteTracker&& other) noexcept -> WriteTracker& {
+        if(this == &other) {
+            return *this;
+        }
+
+        WriteTracker previous {std::move(*this)};// Releases our current region at the end of the scope
+        _region = std::move(other._region);
+        return *this;
+    }
+
+    auto WriteTracker::protect(MappingRange range) noexcept -> Result<void> {
+        if(_region == nullptr) {
+            return {};
+        }
+
+        if(!range.is_within(_region->size)) {
+            return Error {fmt::format("Could not write-protect range {}..{}: exceeds region size {}", range.offset,
+                                      range.get_end(), _region->size)};
+        }
+
+        const auto aligned_range = range.align_to(_region->page_size);
+        auto* address = _region->address + aligned_range.offset;// NOLINT
+
+        if(::mprotect(address, aligned_range.size, get_native_protection(_region->access, false)) != 0) {
+            return Error {fmt::format("Could not write-protect range: {}", get_last_error())};
+        }
+
+        return {};
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_LINUX
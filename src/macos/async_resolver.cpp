@@ -0,0 +1,56 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_APPLE
+
+#include "kstd/platform/async_resolver.hpp"
+
+namespace kstd::platform {
+    struct AsyncResolverState final {};
+
+    AsyncResolver::AsyncResolver([[maybe_unused]] std::vector<std::string> dns_addresses,
+                                 [[maybe_unused]] std::chrono::milliseconds timeout,
+                                 [[maybe_unused]] usize attempt_count) {
+        throw std::runtime_error {"Could not create asynchronous resolver: epoll is not available on macOS"};
+    }
+
+    AsyncResolver::AsyncResolver(AsyncResolver&& other) noexcept = default;
+
+    AsyncResolver::~AsyncResolver() noexcept = default;
+
+    auto AsyncResolver::operator=(AsyncResolver&& other) noexcept -> AsyncResolver& = default;
+
+    auto AsyncResolver::resolve(const std::string& address, [[maybe_unused]] RecordType type, DnsCallback callback)
+            -> void {
+        const auto reason = "The asynchronous resolver is not supported on macOS";
+        callback(Error {fmt::format("Unable to resolve address of {}: {}", address, reason)});
+    }
+
+    auto AsyncResolver::resolve(const std::string& address, RecordType type) -> std::future<Result<DnsAnswer>> {
+        std::promise<Result<DnsAnswer>> promise {};
+        resolve(address, type, [&promise](Result<DnsAnswer> result) { promise.set_value(std::move(result)); });
+        return promise.get_future();
+    }
+
+    auto AsyncResolver::get_statistics() const noexcept -> AsyncResolverStatistics {
+        return {};
+    }
+}// namespace kstd::platform
+
+#endif// PLATFORM_APPLE
@@ -23,62 +23,111 @@
 
 namespace kstd::platform {
     Resolver::Resolver(const std::vector<std::string> dns_addresses) :
-            _dns_addresses {dns_addresses} {
+            Resolver {} {
         if(dns_addresses.size() == 0) {
             throw std::runtime_error("Unable to initialize list of DNS servers: No DNS server specified");
         }
+
+        if(dns_addresses.size() > MAXNS) {
+            throw std::runtime_error {fmt::format(
+                    "Unable to initialize list of DNS servers: Only up to {} DNS servers are supported", MAXNS)};
+        }
+
+        for(usize index = 0; index < dns_addresses.size(); ++index) {
+            _state->nsaddr_list[index] = parse_nameserver_address(dns_addresses[index]);// NOLINT
+        }
+
+        _state->nscount = static_cast<int>(dns_addresses.size());
     }
 
     Resolver::Resolver() :
-            _dns_addresses {} {
+            _state {},
+            _cache {std::make_shared<DnsCache<DnsAnswer>>()} {
+        auto state = std::make_unique<struct __res_state>();
+
+        if(::res_ninit(state.get()) != 0) {
+            throw std::runtime_error {fmt::format("Could not initialize resolver: {}", get_last_error())};
+        }
+
+        _state.reset(state.release());// Only closed once it was initialized
     }
 
     Resolver::~Resolver() {
     }
 
-    auto Resolver::resolve(const std::string& address, const RecordType type) noexcept -> kstd::Result<std::string> {
-        if(address == "localhost") {
-            switch(type) {
-                case RecordType::A: return kstd::Result<std::string> {"127.0.0.1"};
-                case RecordType::AAAA: return kstd::Result<std::string> {"::1"};
+    auto Resolver::resolve_many(const std::vector<std::string>& addresses, const std::vector<RecordType>& types,
+                                [[maybe_unused]] usize window_size) -> std::vector<kstd::Result<DnsAnswer>> {
+        std::vector<kstd::Result<DnsAnswer>> results {};
+        results.reserve(addresses.size() * types.size());
+
+        for(const auto& address : addresses) {
+            for(const auto type : types) {
+                results.push_back(resolve(address, type));
             }
         }
 
-        // Init resolv API
-        res_init();
+        return results;
+    }
 
-        // Generate custom nameserver list if needed
-        if(_dns_addresses.size() > 0) {
-            _res.nscount = _dns_addresses.size();
-            for(int i = 0; i < _res.nscount; ++i) {
-                if(is_ipv4_address(_dns_addresses[i])) {
-                    _res.nsaddr_list[i].sin_family = AF_INET;
-                }
-                else if(is_ipv6_address(_dns_addresses[i])) {
-                    _res.nsaddr_list[i].sin_family = AF_INET6;
-                }
-                else {
-                    return kstd::Error {fmt::format("Unable to resolve address of {}: Illegal DNS server address {}",
-                                                    address, _dns_addresses[i])};
-                }
-                _res.nsaddr_list[i].sin_addr.s_addr = ::inet_addr(_dns_addresses[i].c_str());
-                _res.nsaddr_list[i].sin_port = htons(53);
+    auto Resolver::set_timeout(std::chrono::seconds timeout, usize attempt_count) noexcept -> void {
+        _state->retrans = static_cast<int>(std::max<std::chrono::seconds::rep>(timeout.count(), 1));
+        _state->retry = static_cast<int>(std::max<usize>(attempt_count, 1));
+    }
+
+    auto Resolver::resolve(const std::string& address, const RecordType type) noexcept -> kstd::Result<DnsAnswer> {
+        if(address == "localhost") {
+            switch(type) {
+                case RecordType::A: return get_loopback_answer(false);
+                case RecordType::AAAA: return get_loopback_answer(true);
             }
         }
 
+        if(auto cached = find_cached(address, type); cached) {
+            return *cached;
+        }
+
         // Send DNS request
         std::array<u_char, 4096> response_buffer {'\0'};
-        kstd::isize response_length = ::res_query(address.c_str(), __ns_class::ns_c_in, static_cast<int>(type),
-                                                  response_buffer.data(), sizeof(response_buffer));
+        kstd::isize response_length = ::res_nquery(_state.get(), address.c_str(), __ns_class::ns_c_in,
+                                                   static_cast<int>(type), response_buffer.data(),
+                                                   sizeof(response_buffer));
 
         if(response_length < 0) {
-            return kstd::Error {fmt::format("Unable to resolve address {}: {}", address, get_last_error())};
+            auto message = fmt::format("Unable to resolve address {}: {}", address, get_last_error());
+
+            // The response is left in the buffer even if it carries an error, so NXDOMAIN can be cached too
+            if(_cache != nullptr) {
+                const auto record_type = static_cast<u16>(type);
+                const auto answer = parse_dns_answer(response_buffer.data(), response_buffer.size(), record_type);
+
+                if(answer && answer->is_negative() && answer->ttl != 0) {
+                    _cache->insert_negative(address, record_type, message, std::chrono::seconds {answer->ttl});
+                }
+            }
+
+            return kstd::Error {std::move(message)};
         }
 
         if(response_length == 0) {
             return kstd::Error {fmt::format("Unable to resolve address {}: There is no response", address)};
         }
-        return std::string {response_buffer.cbegin(), response_buffer.cbegin() + response_length + 1};
+
+        const auto response_size = static_cast<usize>(response_length);
+        auto answer = parse_dns_answer(response_buffer.data(), response_size, static_cast<u16>(type));
+
+        if(!answer) {
+            return kstd::Error {fmt::format("Unable to resolve address {}: {}", address, answer.get_error())};
+        }
+
+        if(answer->addresses.empty()) {
+            return kstd::Error {fmt::format("Unable to resolve address {}: There is no address", address)};
+        }
+
+        if(_cache != nullptr) {
+            _cache->insert(address, static_cast<u16>(type), *answer, std::chrono::seconds {answer->ttl});
+        }
+
+        return answer;
     }
 }// namespace kstd::platform
 
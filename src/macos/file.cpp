@@ -22,9 +22,29 @@
 #include "kstd/platform/file.hpp"
 
 #include "kstd/utils.hpp"
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <vector>
 
 namespace kstd::platform::file {
+    struct PageSpan final {
+        usize offset;
+        usize size;
+        usize page_count;
+    };
+
+    // Clamps the byte range to the file and widens it to page boundaries
+    [[nodiscard]] static auto to_page_span(usize offset, usize size, usize file_size, usize page_size) noexcept
+            -> PageSpan {
+        if(size == 0 || size > file_size - offset) {
+            size = file_size - offset;
+        }
+
+        const auto begin = offset - (offset % page_size);
+        const auto end = ((offset + size + page_size - 1) / page_size) * page_size;
+        return {begin, end - begin, (end - begin) / page_size};
+    }
+
     File::File(const File& other) :
             File(other._path, other._mode) {
     }
@@ -149,6 +169,16 @@ namespace kstd::platform::file {
         return static_cast<usize>(stats.st_size);
     }
 
+    auto File::get_identity() const noexcept -> Result<FileIdentity> {
+        struct stat stats {};
+
+        if(::fstat(_handle, &stats) != 0) {
+            return Error {fmt::format("Could not retrieve file identity for {}: {}", _path.string(), get_last_error())};
+        }
+
+        return FileIdentity {static_cast<u64>(stats.st_dev), static_cast<u64>(stats.st_ino)};
+    }
+
     auto File::resize(usize size) const noexcept -> Result<void> {
         if(::ftruncate(_handle, static_cast<NativeOffset>(size)) == -1) {
             return Error {fmt::format("Could not set file pointer for {}: {}", _path.string(), get_last_error())};
@@ -157,6 +187,62 @@ namespace kstd::platform::file {
         return {};
     }
 
+    auto File::get_cache_statistics(usize offset, usize size) const noexcept -> Result<CacheStatistics> {
+        auto residency = get_residency(offset, size);
+
+        if(!residency) {
+            return residency.forward<CacheStatistics>();
+        }
+
+        return CacheStatistics {residency->get_page_size(), residency->get_page_count(),
+                                residency->get_resident_page_count(), 0, 0, 0, 0};
+    }
+
+    auto File::get_residency(usize offset, usize size) const noexcept -> Result<PageResidency> {
+        const auto file_size = get_size();
+
+        if(!file_size) {
+            return file_size.forward<PageResidency>();
+        }
+
+        if(offset > *file_size) {
+            return Error {fmt::format("Could not query residency of {}: offset {} exceeds file size {}",
+                                      _path.string(), offset, *file_size)};
+        }
+
+        const auto page_size = get_page_size();
+        const auto span = to_page_span(offset, size, *file_size, page_size);
+        PageResidency residency {page_size, span.page_count};
+
+        if(span.page_count == 0) {
+            return residency;
+        }
+
+        // Mapping without touching faults nothing in, so mincore reports the page cache itself
+        const auto native_offset = static_cast<NativeOffset>(span.offset);
+        auto* address = ::mmap(nullptr, span.size, PROT_READ, MAP_SHARED, _handle, native_offset);
+
+        if(address == MAP_FAILED) {
+            return Error {fmt::format("Could not map {} for residency query: {}", _path.string(), get_last_error())};
+        }
+
+        std::vector<char> pages(span.page_count);
+        const auto is_queried = ::mincore(address, span.size, pages.data()) == 0;
+        const auto error = is_queried ? std::string {} : get_last_error();
+        ::munmap(address, span.size);
+
+        if(!is_queried) {
+            return Error {fmt::format("Could not query residency of {}: {}", _path.string(), error)};
+        }
+
+        for(usize page = 0; page < span.page_count; ++page) {
+            if((pages[page] & 1U) != 0) {
+                residency.mark_resident(page);
+            }
+        }
+
+        return residency;
+    }
 }// namespace kstd::platform::file
 
 #endif// PLATFORM_APPLE
\ No newline at end of file
@@ -0,0 +1,95 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_APPLE
+
+#include "kstd/platform/lazy_mapping.hpp"
+
+namespace kstd::platform::mm {
+    struct LazyMappingState final {};
+
+    LazyMapping::LazyMapping(LazyMapping&& other) noexcept :
+            _state {std::move(other._state)},
+            _address {other._address},
+            _size {other._size},
+            _access {other._access} {
+        other._address = nullptr;
+        other._size = 0;
+    }
+
+    LazyMapping::LazyMapping() noexcept :
+            _address {nullptr},
+            _size {0},
+            _access {MappingAccess::NONE} {
+    }
+
+    LazyMapping::LazyMapping([[maybe_unused]] usize size, [[maybe_unused]] PageProvider provider,
+                             MappingAccess access) :
+            _address {nullptr},
+            _size {0},
+            _access {access} {
+        throw std::runtime_error {"Could not create lazy mapping: userfaultfd is not available on macOS"};
+    }
+
+    LazyMapping::~LazyMapping() noexcept = default;
+
+    auto LazyMapping::operator=(LazyMapping&& other) noexcept -> LazyMapping& {
+        if(this == &other) {
+            return *this;
+        }
+
+        _state = std::move(other._state);
+        _address = other._address;
+        _size = other._size;
+        _access = other._access;
+        other._address = nullptr;
+        other._size = 0;
+        return *this;
+    }
+
+    auto LazyMapping::resize([[maybe_unused]] usize size) noexcept -> Result<void> {
+        return Error {std::string("Could not resize lazy mapping: lazy mappings have a fixed size")};
+    }
+
+    auto LazyMapping::sync() noexcept -> Result<void> {
+        return {};
+    }
+
+    auto LazyMapping::get_type() const noexcept -> MappingType {
+        return MappingType::LAZY;
+    }
+
+    auto LazyMapping::get_access() const noexcept -> MappingAccess {
+        return _access;
+    }
+
+    auto LazyMapping::get_address() const noexcept -> void* {
+        return _address;
+    }
+
+    auto LazyMapping::get_size() const noexcept -> usize {
+        return _size;
+    }
+
+    auto LazyMapping::get_statistics() const noexcept -> LazyMappingStatistics {
+        return {};
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_APPLE
@@ -0,0 +1,230 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_APPLE
+
+#include "kstd/platform/memory_mapping.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <sys/resource.h>
+#include <vector>
+
+namespace kstd::platform::mm {
+    auto get_lock_limit() noexcept -> Result<usize> {
+        rlimit limit {};
+
+        if(::getrlimit(RLIMIT_MEMLOCK, &limit) != 0) {
+            return Error {fmt::format("Could not get lock limit: {}", get_last_error())};
+        }
+
+        if(limit.rlim_cur == RLIM_INFINITY) {
+            return std::numeric_limits<usize>::max();
+        }
+
+        return static_cast<usize>(limit.rlim_cur);
+    }
+
+    auto lock_process_memory(ProcessLockFlags flags) noexcept -> Result<void> {
+        return Error {std::string("Could not lock process memory: not supported on macOS")};
+    }
+
+    auto unlock_process_memory() noexcept -> Result<void> {
+        return Error {std::string("Could not unlock process memory: not supported on macOS")};
+    }
+
+    auto MemoryMapping::advise(MappingRange range, MappingAdvice advice) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not advise mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        i32 native_advice = MADV_NORMAL;
+
+        switch(advice) {
+            case MappingAdvice::NORMAL: native_advice = MADV_NORMAL; break;
+            case MappingAdvice::SEQUENTIAL: native_advice = MADV_SEQUENTIAL; break;
+            case MappingAdvice::RANDOM: native_advice = MADV_RANDOM; break;
+            case MappingAdvice::WILL_NEED:
+            case MappingAdvice::POPULATE_READ: native_advice = MADV_WILLNEED; break;
+            case MappingAdvice::DONT_NEED: native_advice = MADV_DONTNEED; break;
+            default: return Error {std::string("Could not advise mapping: advice is not supported on macOS")};
+        }
+
+        const auto page_size = get_page_size();
+        // Rounding outward would drop the bytes around the range from private pages
+        const auto aligned_range = advice == MappingAdvice::DONT_NEED ? range.shrink_to(page_size, get_size())
+                                                                      : range.align_to(page_size);
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(aligned_range.size == 0) {
+            return {};
+        }
+
+        if(::madvise(address, aligned_range.size, native_advice) != 0) {
+            return Error {fmt::format("Could not advise mapping: {}", get_last_error())};
+        }
+
+        const auto is_readable = (get_access() & MappingAccess::READ) == MappingAccess::READ;
+
+        if(advice == MappingAdvice::POPULATE_READ && is_readable) {
+            // There is no MADV_POPULATE_READ on macOS, so we fault every page in by hand
+            for(usize offset = 0; offset < aligned_range.size; offset += page_size) {
+                static_cast<void>(*static_cast<volatile u8*>(address + offset));// NOLINT
+            }
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::sync(MappingRange range, SyncFlags flags) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not sync mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        i32 native_flags = (flags & SyncFlags::ASYNC) == SyncFlags::ASYNC ? MS_ASYNC : MS_SYNC;
+
+        if((flags & SyncFlags::INVALIDATE) == SyncFlags::INVALIDATE) {
+            native_flags |= MS_INVALIDATE;
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(::msync(address, aligned_range.size, native_flags) != 0) {
+            return Error {fmt::format("Could not sync mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::protect(MappingRange range, MappingAccess access) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not protect mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        i32 prot = PROT_NONE;
+
+        if((access & MappingAccess::READ) == MappingAccess::READ) {
+            prot |= PROT_READ;
+        }
+
+        if((access & MappingAccess::WRITE) == MappingAccess::WRITE) {
+            prot |= PROT_WRITE;
+        }
+
+        if((access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE) {
+            prot |= PROT_EXEC;
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(::mprotect(address, aligned_range.size, prot) != 0) {
+            return Error {fmt::format("Could not protect mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::lock(MappingRange range, LockFlags flags) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not lock mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        const auto limit = get_lock_limit();
+
+        // macOS doesn't tell how much is locked already, so only the range itself can be checked
+        if(limit && aligned_range.size > *limit) {
+            return Error {fmt::format("Could not lock {} bytes: exceeds RLIMIT_MEMLOCK of {} bytes", aligned_range.size,
+                                      *limit)};
+        }
+
+        // There is no lock-on-fault on macOS, so the whole range is populated right away
+        if(::mlock(address, aligned_range.size) != 0) {
+            return Error {fmt::format("Could not lock mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::unlock(MappingRange range) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not unlock mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(::munlock(address, aligned_range.size) != 0) {
+            return Error {fmt::format("Could not unlock mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::get_private_page_count() const noexcept -> Result<usize> {
+        const auto page_size = get_page_size();
+        const auto page_count = (get_size() + page_size - 1) / page_size;
+        std::vector<char> pages(page_count);
+
+        if(::mincore(get_address(), get_size(), pages.data()) != 0) {
+            return Error {fmt::format("Could not query page state: {}", get_last_error())};
+        }
+
+        return static_cast<usize>(std::count_if(pages.cbegin(), pages.cend(), [](auto state) {
+            return (state & MINCORE_COPIED) == MINCORE_COPIED;
+        }));
+    }
+
+    auto MemoryMapping::get_residency(MappingRange range) const noexcept -> Result<PageResidency> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not query residency: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto page_size = get_page_size();
+        const auto aligned_range = range.align_to(page_size);
+        const auto page_count = aligned_range.size / page_size;
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        std::vector<char> pages(page_count);
+
+        if(page_count > 0 && ::mincore(address, aligned_range.size, pages.data()) != 0) {
+            return Error {fmt::format("Could not query residency: {}", get_last_error())};
+        }
+
+        PageResidency residency {page_size, page_count};
+
+        for(usize page = 0; page < page_count; ++page) {
+            if((pages[page] & 1U) != 0) {
+                residency.mark_resident(page);
+            }
+        }
+
+        return residency;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_APPLE
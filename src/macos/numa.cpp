@@ -0,0 +1,67 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_APPLE
+
+#include "kstd/platform/numa.hpp"
+#include "kstd/platform/memory_mapping.hpp"
+
+#include <cerrno>
+
+namespace kstd::platform {
+    auto get_numa_node_count() noexcept -> usize {
+        return 1;
+    }
+
+    auto set_thread_numa_policy(NumaPolicy policy, const std::vector<u32>& nodes) noexcept -> Result<void> {
+        return validate_numa_policy(policy, nodes);
+    }
+}// namespace kstd::platform
+
+namespace kstd::platform::mm {
+    auto MemoryMapping::set_numa_policy(MappingRange range, NumaPolicy policy, const std::vector<u32>& nodes,
+                                        bool move_existing) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not set NUMA policy: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        return validate_numa_policy(policy, nodes);
+    }
+
+    auto MemoryMapping::get_numa_nodes(MappingRange range) const noexcept -> Result<std::vector<i32>> {
+        auto residency = get_residency(range);
+
+        if(!residency) {
+            return residency.forward<std::vector<i32>>();
+        }
+
+        std::vector<i32> nodes(residency->get_page_count(), -ENOENT);
+
+        for(usize page = 0; page < nodes.size(); ++page) {
+            if(residency->is_resident(page)) {
+                nodes[page] = 0;
+            }
+        }
+
+        return nodes;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_APPLE
@@ -0,0 +1,102 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_WINDOWS
+
+#include "kstd/platform/code_allocator.hpp"
+
+namespace kstd::platform::mm {
+    CodeAllocator::CodeAllocator(CodeAllocator&& other) noexcept :
+            _chunks {std::move(other._chunks)},
+            _free_blocks {std::move(other._free_blocks)},
+            _free_size {other._free_size},
+            _chunk_size {other._chunk_size} {
+        other._chunks.clear();
+        other._free_size = 0;
+    }
+
+    CodeAllocator::CodeAllocator(usize chunk_size) noexcept :
+            _free_size {0},
+            _chunk_size {chunk_size} {
+    }
+
+    CodeAllocator::~CodeAllocator() noexcept {
+        std::for_each(_chunks.cbegin(), _chunks.cend(), unmap_chunk);
+    }
+
+    auto CodeAllocator::operator=(CodeAllocator&& other) noexcept -> CodeAllocator& {
+        if(this == &other) {
+            return *this;
+        }
+
+        CodeAllocator previous {std::move(*this)};// Releases our current chunks at the end of the scope
+        _chunks = std::move(other._chunks);
+        _free_blocks = std::move(other._free_blocks);
+        _free_size = other._free_size;
+        _chunk_size = other._chunk_size;
+        other._chunks.clear();
+        other._free_size = 0;
+        return *this;
+    }
+
+    auto CodeAllocator::map_chunk(usize size) noexcept -> Result<CodeChunk> {
+        const auto size_high = static_cast<DWORD>(static_cast<u64>(size) >> 32);
+        const auto size_low = static_cast<DWORD>(static_cast<u64>(size) & 0xFFFFFFFFU);
+        constexpr auto protection = PAGE_EXECUTE_READWRITE;// Only the maximum, each view narrows it down
+        auto* handle = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, protection, size_high, size_low, nullptr);
+
+        if(handle == nullptr) {
+            return Error {fmt::format("Could not create code memory: {}", get_last_error())};
+        }
+
+        auto* writable = ::MapViewOfFile(handle, FILE_MAP_WRITE, 0, 0, size);
+        auto* executable = ::MapViewOfFile(handle, FILE_MAP_READ | FILE_MAP_EXECUTE, 0, 0, size);
+        const auto error = get_last_error();
+        ::CloseHandle(handle);// Both views keep the section alive
+
+        if(writable == nullptr || executable == nullptr) {
+            if(writable != nullptr) {
+                ::UnmapViewOfFile(writable);
+            }
+
+            if(executable != nullptr) {
+                ::UnmapViewOfFile(executable);
+            }
+
+            return Error {fmt::format("Could not map code memory: {}", error)};
+        }
+
+        return CodeChunk {static_cast<u8*>(writable), static_cast<u8*>(executable), size, 0, 0, 0, 0};
+    }
+
+    auto CodeAllocator::unmap_chunk(const CodeChunk& chunk) noexcept -> void {
+        ::UnmapViewOfFile(chunk.writable);
+        ::UnmapViewOfFile(chunk.executable);
+    }
+
+    auto CodeAllocator::flush_instruction_cache(const void* address, usize size) noexcept -> Result<void> {
+        if(!::FlushInstructionCache(::GetCurrentProcess(), address, size)) {
+            return Error {fmt::format("Could not flush instruction cache: {}", get_last_error())};
+        }
+
+        return {};
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_WINDOWS
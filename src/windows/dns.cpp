@@ -21,11 +21,14 @@
 
 #include "kstd/platform/dns.hpp"
 #include <WS2tcpip.h>
+#include <algorithm>
 #include <iostream>
+#include <optional>
 
 namespace kstd::platform {
 
-    Resolver::Resolver(std::vector<std::string> dns_addresses) {
+    Resolver::Resolver(std::vector<std::string> dns_addresses) :
+            _cache {std::make_shared<DnsCache<DnsAnswer>>()} {
         _dns_addresses = {{}};
 
         if(dns_addresses.empty() || dns_addresses.size() > 2) {
@@ -55,7 +58,8 @@ namespace kstd::platform {
         }
     }
 
-    Resolver::Resolver() {
+    Resolver::Resolver() :
+            _cache {std::make_shared<DnsCache<DnsAnswer>>()} {
         // Initialize WSA and throw exception if failed
         WSADATA wsaData {};
         if(FAILED(::WSAStartup(MAKEWORD(2, 2), &wsaData))) {
@@ -68,16 +72,61 @@ namespace kstd::platform {
         ::WSACleanup();
     }
 
-    auto Resolver::resolve(const std::string& address, const RecordType type) noexcept -> kstd::Result<std::string> {
+    auto Resolver::resolve_many(const std::vector<std::string>& addresses, const std::vector<RecordType>& types,
+                                [[maybe_unused]] usize window_size) -> std::vector<kstd::Result<DnsAnswer>> {
+        std::vector<kstd::Result<DnsAnswer>> results {};
+        results.reserve(addresses.size() * types.size());
+
+        for(const auto& address : addresses) {
+            for(const auto type : types) {
+                results.push_back(resolve(address, type));
+            }
+        }
+
+        return results;
+    }
+
+    auto Resolver::set_timeout([[maybe_unused]] std::chrono::seconds timeout,
+                               [[maybe_unused]] usize attempt_count) noexcept -> void {
+        // DnsQuery has no way to configure this
+    }
+
+    auto Resolver::resolve(const std::string& address, const RecordType type) noexcept -> kstd::Result<DnsAnswer> {
         // Send request over DnsQuery function
-        PDNS_RECORD record = nullptr;
+        PDNS_RECORDA record = nullptr;
 
         IP4Array* dns_server_list = nullptr;
         if(_dns_addresses.has_value()) {
             dns_server_list = &_dns_addresses.get();
         }
-        if(FAILED(::DnsQuery(address.data(), static_cast<kstd::u16>(type), DNS_QUERY_STANDARD | DNS_QUERY_BYPASS_CACHE,
-                             dns_server_list, &record, nullptr))) {
+        if(auto cached = find_cached(address, type); cached) {
+            return *cached;
+        }
+
+        const auto status = ::DnsQuery_A(address.data(), static_cast<kstd::u16>(type),
+                                         DNS_QUERY_STANDARD | DNS_QUERY_BYPASS_CACHE, dns_server_list,
+                                         reinterpret_cast<PDNS_RECORD*>(&record), nullptr);// NOLINT
+
+        if(status == DNS_ERROR_RCODE_NAME_ERROR || status == DNS_INFO_NO_RECORDS) {
+            auto message = fmt::format("Error while resolving {}: {}", address, get_last_error());
+
+            // Negative responses come with the SOA record of the zone, which limits how long they may be cached
+            for(auto* current = record; current != nullptr && _cache != nullptr; current = current->pNext) {
+                if(current->wType == DNS_TYPE_SOA) {
+                    const auto ttl = std::min<DWORD>(current->dwTtl, current->Data.SOA.dwDefaultTtl);
+                    _cache->insert_negative(address, static_cast<u16>(type), message, std::chrono::seconds {ttl});
+                    break;
+                }
+            }
+
+            if(record != nullptr) {
+                DnsRecordListFree(record, DnsFreeRecordListDeep);
+            }
+
+            return kstd::Error {std::move(message)};
+        }
+
+        if(FAILED(status)) {
             return kstd::Error {fmt::format("Error while resolving {}: {}", address, get_last_error())};
         }
 
@@ -85,46 +134,47 @@ namespace kstd::platform {
             return kstd::Error {fmt::format("Error while resolving {}: No record returned", address)};
         }
 
-        // Convert record content
-        std::string result;
-        switch(type) {
-            case RecordType::A: {
-                // Convert binary representation to literal representation of IPv4 address
-                SOCKADDR_IN addr {};
-                addr.sin_family = AF_INET;
-                addr.sin_addr = *reinterpret_cast<in_addr*>(&record->Data.A.IpAddress);// NOLINT
-
-                std::array<wchar_t, 128> address_buffer {};
-                DWORD size = address_buffer.size();
-                if(FAILED(::WSAAddressToStringW(reinterpret_cast<LPSOCKADDR>(&addr), sizeof(addr), nullptr,// NOLINT
-                                                address_buffer.data(), &size))) {
-                    return kstd::Error {
-                            fmt::format("Unable to format IPv4 Address into literal => {}", get_last_error())};
-                }
+        // Collect the addresses and the aliases which led to them
+        DnsAnswer answer {{}, {}, 0, DnsResponseCode::NO_ERROR};
+        std::optional<DWORD> ttl {};
 
-                result = std::string {address_buffer.begin(), address_buffer.begin() + size - 1};
-                break;
+        for(auto* current = record; current != nullptr; current = current->pNext) {
+            if(current->Flags.S.Section != DnsSectionAnswer) {
+                continue;
             }
-            case RecordType::AAAA: {
-                // Convert binary representation to literal representation of IPv6 address
-                SOCKADDR_IN6 addr {};
-                addr.sin6_family = AF_INET6;
-                addr.sin6_addr = *reinterpret_cast<in_addr6*>(&record->Data.AAAA.Ip6Address);// NOLINT
-
-                std::array<wchar_t, 128> address_buffer {};
-                DWORD size = address_buffer.size();
-                if(FAILED(::WSAAddressToStringW(reinterpret_cast<LPSOCKADDR>(&addr), sizeof(addr), nullptr,// NOLINT
-                                                address_buffer.data(), &size))) {
-                    return kstd::Error {
-                            fmt::format("Unable to format IPv4 Address into literal => {}", get_last_error())};
-                }
 
-                result = std::string {address_buffer.begin(), address_buffer.begin() + size - 1};
-                break;
+            if(current->wType == DNS_TYPE_CNAME) {
+                answer.cnames.emplace_back(current->Data.CNAME.pNameHost);
+            }
+            else if(current->wType == DNS_TYPE_A && type == RecordType::A) {
+                DnsAddress entry {{}, sizeof(in_addr), current->dwTtl};
+                std::memcpy(entry.bytes.data(), &current->Data.A.IpAddress, sizeof(in_addr));
+                answer.addresses.push_back(entry);
+            }
+            else if(current->wType == DNS_TYPE_AAAA && type == RecordType::AAAA) {
+                DnsAddress entry {{}, sizeof(in6_addr), current->dwTtl};
+                std::memcpy(entry.bytes.data(), &current->Data.AAAA.Ip6Address, sizeof(in6_addr));
+                answer.addresses.push_back(entry);
+            }
+            else {
+                continue;
             }
+
+            ttl = std::min(ttl.value_or(current->dwTtl), current->dwTtl);
         }
+
+        answer.ttl = ttl.value_or(0);
         DnsRecordListFree(record, DnsFreeRecordListDeep);
-        return result;
+
+        if(answer.addresses.empty()) {
+            return kstd::Error {fmt::format("Error while resolving {}: No address returned", address)};
+        }
+
+        if(_cache != nullptr) {
+            _cache->insert(address, static_cast<u16>(type), answer, std::chrono::seconds {answer.ttl});
+        }
+
+        return answer;
     }
 
 }// namespace kstd::platform
@@ -125,6 +125,17 @@ namespace kstd::platform::file {
         return static_cast<usize>(size.QuadPart);
     }
 
+    auto File::get_identity() const noexcept -> Result<FileIdentity> {
+        BY_HANDLE_FILE_INFORMATION info {};
+
+        if(!::GetFileInformationByHandle(_handle, &info)) {
+            return Error {fmt::format("Could not retrieve file identity for {}: {}", _path.string(), get_last_error())};
+        }
+
+        const auto index = (static_cast<u64>(info.nFileIndexHigh) << 32) | static_cast<u64>(info.nFileIndexLow);
+        return FileIdentity {static_cast<u64>(info.dwVolumeSerialNumber), index};
+    }
+
     auto File::resize(usize size) const noexcept -> Result<void> {
         LARGE_INTEGER distance {};
         distance.QuadPart = static_cast<LONGLONG>(size);
@@ -146,6 +157,15 @@ namespace kstd::platform::file {
         return {};
     }
 
+    // Windows doesn't expose which pages of a file the cache manager holds
+    auto File::get_cache_statistics(usize offset, usize size) const noexcept -> Result<CacheStatistics> {
+        return Error {fmt::format("Could not query cache statistics of {}: not supported on Windows", _path.string())};
+    }
+
+    auto File::get_residency(usize offset, usize size) const noexcept -> Result<PageResidency> {
+        return Error {fmt::format("Could not query residency of {}: not supported on Windows", _path.string())};
+    }
+
 }// namespace kstd::platform::file
 
 #endif// PLATFORM_WINDOWS
\ No newline at end of file
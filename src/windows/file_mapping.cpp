@@ -23,54 +23,113 @@
 
 namespace kstd::platform::mm {
     FileMapping::FileMapping(const kstd::platform::mm::FileMapping& other) :
-            FileMapping(other._file.get_path(), other._access) {
+            FileMapping(other._file.get_path(), other._access, other._flags) {
     }
 
     FileMapping::FileMapping(kstd::platform::mm::FileMapping&& other) noexcept :
             _file {std::move(other._file)},
             _type {other._type},
             _access {other._access},
-            _address {other._address} {
+            _flags {other._flags},
+            _address {other._address},
+            _size {other._size},
+            _dirty_pages {std::move(other._dirty_pages)},
+            _write_tracker {std::move(other._write_tracker)},
+            _handle {other._handle} {
         other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
     }
 
     FileMapping::FileMapping() noexcept :
             _type {MappingType::FILE},
             _access {MappingAccess::NONE},
-            _address {nullptr} {
+            _flags {MappingFlags::NONE},
+            _address {nullptr},
+            _size {0} {
     }
 
-    FileMapping::FileMapping(std::filesystem::path path, MappingAccess access) :
-            _file {file::File {std::move(path), derive_file_mode(access)}},
+    FileMapping::FileMapping(std::filesystem::path path, MappingAccess access, MappingFlags flags) :
+            _file {file::File {std::move(path), derive_checked_file_mode(access, flags)}},
             _type {MappingType::FILE},
             _access {access},
-            _address {nullptr} {
-        const auto is_readable = (_access & MappingAccess::READ) == MappingAccess::READ;
-        const auto is_writable = (_access & MappingAccess::WRITE) == MappingAccess::WRITE;
-        const auto is_executable = (_access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE;
-
-        if(is_executable && !_file.is_executable()) {
-            _file.set_executable().throw_if_error();
-        }
-
+            _flags {flags},
+            _address {nullptr},
+            _size {0} {
         auto size = _file.get_size().get_or(0);
 
         if(size == 0) {
+            // The file was opened read-only and a private mapping must never change it
+            if((_flags & MappingFlags::PRIVATE) == MappingFlags::PRIVATE) {
+                throw std::runtime_error {
+                        fmt::format("Could not privately map {}: the file is empty", _file.get_path().string())};
+            }
+
             _file.resize(1).throw_if_error();
             size = 1;// Make sure we map at least one byte of data
         }
 
+        _address = map(size).get_or_throw();
+        _size = size;
+        _dirty_pages = DirtyPageMap {_size};
+
+        if((_flags & MappingFlags::POPULATE) == MappingFlags::POPULATE) {
+            WIN32_MEMORY_RANGE_ENTRY range {_address, _size};
+            ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+        }
+    }
+
+    auto FileMapping::operator=(const kstd::platform::mm::FileMapping& other) -> FileMapping& {
+        if(this == &other) {
+            return *this;
+        }
+        *this = FileMapping {other._file.get_path(), other._access, other._flags};
+        return *this;
+    }
+
+    auto FileMapping::operator=(kstd::platform::mm::FileMapping&& other) noexcept -> FileMapping& {
+        if(this == &other) {
+            return *this;
+        }
+
+        FileMapping previous {std::move(*this)};// Releases our current mapping at the end of the scope
+        _file = std::move(other._file);
+        _type = other._type;
+        _access = other._access;
+        _flags = other._flags;
+        _address = other._address;
+        _size = other._size;
+        _dirty_pages = std::move(other._dirty_pages);
+        _write_tracker = std::move(other._write_tracker);
+        _handle = other._handle;
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+        return *this;
+    }
+
+    auto FileMapping::map(usize size) noexcept -> Result<void*> {
+        const auto is_readable = (_access & MappingAccess::READ) == MappingAccess::READ;
+        const auto is_writable = (_access & MappingAccess::WRITE) == MappingAccess::WRITE;
+        const auto is_executable = (_access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE;
+        const auto is_private = (_flags & MappingFlags::PRIVATE) == MappingFlags::PRIVATE;
         DWORD map_prot = 0;
         DWORD map_access = 0;
 
-        if(is_writable) {
+        if(is_writable && is_private) {
+            map_prot = (is_executable ? PAGE_EXECUTE_WRITECOPY : PAGE_WRITECOPY);
+        }
+        else if(is_writable) {
             map_prot = (is_executable ? PAGE_EXECUTE_READWRITE : PAGE_READWRITE);
         }
         else if(is_readable) {
             map_prot = (is_executable ? PAGE_EXECUTE_READ : PAGE_READONLY);
         }
 
-        if(is_writable && is_readable) {
+        if(is_writable && is_private) {
+            map_access = FILE_MAP_COPY;
+        }
+        else if(is_writable && is_readable) {
             map_access = FILE_MAP_ALL_ACCESS;
         }
         else if(is_writable) {
@@ -84,39 +143,28 @@ namespace kstd::platform::mm {
             map_access |= FILE_MAP_EXECUTE;
         }
 
-        _handle = ::CreateFileMappingW(_file.get_handle(), &_file.get_security_attribs(), map_prot, 0, 0, nullptr);
+        auto* handle = ::CreateFileMappingW(_file.get_handle(), &_file.get_security_attribs(), map_prot, 0, 0, nullptr);
 
-        if(!_handle.is_valid()) {
-            throw std::runtime_error {fmt::format("Could not open shared memory handle for {}: {}",
-                                                  _file.get_path().string(), get_last_error())};
+        if(handle == nullptr) {
+            return Error {fmt::format("Could not open shared memory handle for {}: {}", _file.get_path().string(),
+                                      get_last_error())};
         }
 
-        _address = ::MapViewOfFileEx(_handle, map_access, 0, 0, 0, nullptr);
+        auto* address = ::MapViewOfFileEx(handle, map_access, 0, 0, 0, nullptr);
 
-        if(_address == nullptr) {
-            throw std::runtime_error {
-                    fmt::format("Could not map shared memory for {}: {}", _file.get_path().string(), get_last_error())};
+        if(address == nullptr) {
+            const auto error = get_last_error();
+            ::CloseHandle(handle);
+            return Error {fmt::format("Could not map shared memory for {}: {}", _file.get_path().string(), error)};
         }
-    }
-
-    auto FileMapping::operator=(const kstd::platform::mm::FileMapping& other) -> FileMapping& {
-        if(this == &other) {
-            return *this;
-        }
-        *this = FileMapping {other._file.get_path(), other._access};
-        return *this;
-    }
 
-    auto FileMapping::operator=(kstd::platform::mm::FileMapping&& other) noexcept -> FileMapping& {
-        _file = std::move(other._file);
-        _type = other._type;
-        _access = other._access;
-        _address = other._address;
-        other._address = nullptr;
-        return *this;
+        _handle = handle;
+        return address;
     }
 
     FileMapping::~FileMapping() noexcept {
+        _write_tracker = WriteTracker {};
+
         if(_address != nullptr) {
             ::UnmapViewOfFile(_address);
             ::CloseHandle(_handle);
@@ -124,10 +172,54 @@ namespace kstd::platform::mm {
     }
 
     auto FileMapping::resize(usize size) noexcept -> Result<void> {
-        return _file.resize(size);
+        if((_flags & MappingFlags::PRIVATE) == MappingFlags::PRIVATE) {
+            return Error {fmt::format("Could not resize mapping of {}: private mappings never change the file",
+                                      _file.get_path().string())};
+        }
+
+        size = std::max<usize>(size, 1);// Like the constructor, always map at least one byte
+
+        if(_address == nullptr) {
+            return _file.resize(size);
+        }
+
+        // Files can't change their size while a section of them exists, so the mapping is recreated
+        const auto is_tracking = is_write_tracking();
+        _write_tracker = WriteTracker {};// Its protected region refers to the old address and size
+        ::UnmapViewOfFile(_address);
+        ::CloseHandle(_handle);
+        _handle = invalid_file_handle;
+
+        auto result = _file.resize(size);
+        const auto mapped_size = result ? size : _size;
+        auto address = map(mapped_size);
+
+        if(!address) {
+            _address = nullptr;
+            _size = 0;
+            return address.forward<void>();
+        }
+
+        auto rebind_result = rebind(*address, mapped_size, is_tracking);
+        return result ? rebind_result : result;
     }
 
     auto FileMapping::sync() noexcept -> Result<void> {
+        return sync({0, _size});
+    }
+
+    auto FileMapping::sync(MappingRange range, SyncFlags flags) noexcept -> Result<void> {
+        auto result = MemoryMapping::sync(range, flags);
+
+        if(!result || (flags & SyncFlags::ASYNC) == SyncFlags::ASYNC) {
+            return result;
+        }
+
+        // FlushViewOfFile only initiates the write-back, so wait for the file itself to hit the disk
+        if(!::FlushFileBuffers(_file.get_handle())) {
+            return Error {fmt::format("Could not flush file {}: {}", _file.get_path().string(), get_last_error())};
+        }
+
         return {};
     }
 
@@ -142,6 +234,10 @@ namespace kstd::platform::mm {
     auto FileMapping::get_address() const noexcept -> void* {
         return _address;
     }
+
+    auto FileMapping::get_size() const noexcept -> usize {
+        return _size;
+    }
 }// namespace kstd::platform::mm
 
 #endif// PLATFORM_WINDOWS
\ No newline at end of file
@@ -0,0 +1,218 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_WINDOWS
+
+#include "kstd/platform/memory_mapping.hpp"
+
+#include <algorithm>
+#include <psapi.h>
+#include <vector>
+
+namespace kstd::platform::mm {
+    auto get_lock_limit() noexcept -> Result<usize> {
+        SIZE_T minimum_size = 0;
+        SIZE_T maximum_size = 0;
+
+        // Pages locked by a process count against its minimum working set
+        if(!::GetProcessWorkingSetSize(::GetCurrentProcess(), &minimum_size, &maximum_size)) {
+            return Error {fmt::format("Could not get lock limit: {}", get_last_error())};
+        }
+
+        return static_cast<usize>(minimum_size);
+    }
+
+    auto lock_process_memory(ProcessLockFlags flags) noexcept -> Result<void> {
+        return Error {std::string("Could not lock process memory: not supported on Windows")};
+    }
+
+    auto unlock_process_memory() noexcept -> Result<void> {
+        return Error {std::string("Could not unlock process memory: not supported on Windows")};
+    }
+
+    auto MemoryMapping::advise(MappingRange range, MappingAdvice advice) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not advise mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        switch(advice) {
+            case MappingAdvice::NORMAL:
+            case MappingAdvice::SEQUENTIAL:
+            case MappingAdvice::RANDOM: return {};// Access pattern hints have no equivalent on Windows
+            case MappingAdvice::WILL_NEED:
+            case MappingAdvice::POPULATE_READ: break;
+            default: return Error {std::string("Could not advise mapping: advice is not supported on Windows")};
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        WIN32_MEMORY_RANGE_ENTRY entry {static_cast<u8*>(get_address()) + aligned_range.offset,// NOLINT
+                                        aligned_range.size};
+
+        if(!::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &entry, 0)) {
+            return Error {fmt::format("Could not advise mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::sync(MappingRange range, SyncFlags flags) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not sync mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        // Views of the same section are always coherent, so there is nothing to invalidate
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(!::FlushViewOfFile(address, aligned_range.size)) {
+            return Error {fmt::format("Could not sync mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::protect(MappingRange range, MappingAccess access) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not protect mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto is_readable = (access & MappingAccess::READ) == MappingAccess::READ;
+        const auto is_writable = (access & MappingAccess::WRITE) == MappingAccess::WRITE;
+        const auto is_executable = (access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE;
+        DWORD protection = PAGE_NOACCESS;
+
+        if(is_writable) {
+            protection = is_executable ? PAGE_EXECUTE_READWRITE : PAGE_READWRITE;
+        }
+        else if(is_readable) {
+            protection = is_executable ? PAGE_EXECUTE_READ : PAGE_READONLY;
+        }
+        else if(is_executable) {
+            protection = PAGE_EXECUTE;
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        DWORD old_protection = 0;
+
+        if(!::VirtualProtect(address, aligned_range.size, protection, &old_protection)) {
+            return Error {fmt::format("Could not protect mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::lock(MappingRange range, LockFlags flags) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not lock mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        const auto limit = get_lock_limit();
+
+        if(limit && aligned_range.size > *limit) {
+            return Error {fmt::format("Could not lock {} bytes: exceeds minimum working set size of {} bytes",
+                                      aligned_range.size, *limit)};
+        }
+
+        // VirtualLock always faults the whole range in, there is no lock-on-fault
+        if(!::VirtualLock(address, aligned_range.size)) {
+            return Error {fmt::format("Could not lock mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::unlock(MappingRange range) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not unlock mapping: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto aligned_range = range.align_to(get_page_size());
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+
+        if(!::VirtualUnlock(address, aligned_range.size)) {
+            return Error {fmt::format("Could not unlock mapping: {}", get_last_error())};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::get_private_page_count() const noexcept -> Result<usize> {
+        const auto page_size = get_page_size();
+        const auto page_count = (get_size() + page_size - 1) / page_size;
+        std::vector<PSAPI_WORKING_SET_EX_INFORMATION> pages(page_count);
+
+        for(usize page = 0; page < page_count; ++page) {
+            pages[page].VirtualAddress = static_cast<u8*>(get_address()) + page * page_size;// NOLINT
+        }
+
+        const auto buffer_size = static_cast<DWORD>(pages.size() * sizeof(PSAPI_WORKING_SET_EX_INFORMATION));
+
+        if(!::QueryWorkingSetEx(::GetCurrentProcess(), pages.data(), buffer_size)) {
+            return Error {fmt::format("Could not query page state: {}", get_last_error())};
+        }
+
+        // Pages which were copied on write become private to the process
+        return static_cast<usize>(std::count_if(pages.cbegin(), pages.cend(), [](const auto& page) {
+            return page.VirtualAttributes.Valid != 0 && page.VirtualAttributes.Shared == 0;
+        }));
+    }
+
+    auto MemoryMapping::get_residency(MappingRange range) const noexcept -> Result<PageResidency> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not query residency: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto page_size = get_page_size();
+        const auto aligned_range = range.align_to(page_size);
+        const auto page_count = aligned_range.size / page_size;
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        std::vector<PSAPI_WORKING_SET_EX_INFORMATION> pages(page_count);
+
+        for(usize page = 0; page < page_count; ++page) {
+            pages[page].VirtualAddress = address + page * page_size;// NOLINT
+        }
+
+        const auto buffer_size = static_cast<DWORD>(pages.size() * sizeof(PSAPI_WORKING_SET_EX_INFORMATION));
+
+        if(page_count > 0 && !::QueryWorkingSetEx(::GetCurrentProcess(), pages.data(), buffer_size)) {
+            return Error {fmt::format("Could not query residency: {}", get_last_error())};
+        }
+
+        PageResidency residency {page_size, page_count};
+
+        for(usize page = 0; page < page_count; ++page) {
+            if(pages[page].VirtualAttributes.Valid != 0) {
+                residency.mark_resident(page);
+            }
+        }
+
+        return residency;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_WINDOWS
@@ -0,0 +1,106 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_WINDOWS
+
+#include "kstd/platform/numa.hpp"
+#include "kstd/platform/memory_mapping.hpp"
+
+#include <cerrno>
+#include <psapi.h>
+
+namespace kstd::platform {
+    auto get_numa_node_count() noexcept -> usize {
+        ULONG highest_node = 0;
+
+        if(!::GetNumaHighestNodeNumber(&highest_node)) {
+            return 1;
+        }
+
+        return static_cast<usize>(highest_node) + 1;
+    }
+
+    // Windows only places memory by node when it is allocated, not through a policy
+    auto set_thread_numa_policy(NumaPolicy policy, const std::vector<u32>& nodes) noexcept -> Result<void> {
+        if(auto result = validate_numa_policy(policy, nodes); !result) {
+            return result;
+        }
+
+        if(get_numa_node_count() > 1 && policy != NumaPolicy::DEFAULT && policy != NumaPolicy::LOCAL) {
+            return Error {std::string("Could not set thread NUMA policy: not supported on Windows")};
+        }
+
+        return {};
+    }
+}// namespace kstd::platform
+
+namespace kstd::platform::mm {
+    auto MemoryMapping::set_numa_policy(MappingRange range, NumaPolicy policy, const std::vector<u32>& nodes,
+                                        bool move_existing) noexcept -> Result<void> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not set NUMA policy: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        if(auto result = validate_numa_policy(policy, nodes); !result) {
+            return result;
+        }
+
+        if(get_numa_node_count() > 1 && policy != NumaPolicy::DEFAULT && policy != NumaPolicy::LOCAL) {
+            return Error {std::string("Could not set NUMA policy: not supported on Windows")};
+        }
+
+        return {};
+    }
+
+    auto MemoryMapping::get_numa_nodes(MappingRange range) const noexcept -> Result<std::vector<i32>> {
+        if(!range.is_within(get_size())) {
+            return Error {fmt::format("Could not query NUMA nodes: range {}..{} exceeds mapping size {}", range.offset,
+                                      range.get_end(), get_size())};
+        }
+
+        const auto page_size = get_page_size();
+        const auto aligned_range = range.align_to(page_size);
+        const auto page_count = aligned_range.size / page_size;
+        auto* address = static_cast<u8*>(get_address()) + aligned_range.offset;// NOLINT
+        std::vector<PSAPI_WORKING_SET_EX_INFORMATION> pages(page_count);
+
+        for(usize page = 0; page < page_count; ++page) {
+            pages[page].VirtualAddress = address + page * page_size;// NOLINT
+        }
+
+        const auto buffer_size = static_cast<DWORD>(pages.size() * sizeof(PSAPI_WORKING_SET_EX_INFORMATION));
+
+        if(page_count > 0 && !::QueryWorkingSetEx(::GetCurrentProcess(), pages.data(), buffer_size)) {
+            return Error {fmt::format("Could not query NUMA nodes: {}", get_last_error())};
+        }
+
+        std::vector<i32> nodes(page_count, -ENOENT);
+
+        for(usize page = 0; page < page_count; ++page) {
+            if(pages[page].VirtualAttributes.Valid != 0) {
+                nodes[page] = static_cast<i32>(pages[page].VirtualAttributes.Node);
+            }
+        }
+
+        return nodes;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_WINDOWS
@@ -0,0 +1,155 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_WINDOWS
+
+#include "kstd/platform/ring_mapping.hpp"
+
+namespace kstd::platform::mm {
+    static constexpr usize max_ring_map_attempts = 16;
+
+    RingMapping::RingMapping(RingMapping&& other) noexcept :
+            _mode {other._mode},
+            _address {other._address},
+            _size {other._size},
+            _handle {other._handle},
+            _cursors {std::move(other._cursors)} {
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+    }
+
+    RingMapping::RingMapping() noexcept :
+            _mode {RingMode::SINGLE_PRODUCER},
+            _address {nullptr},
+            _size {0},
+            _handle {invalid_file_handle} {
+    }
+
+    RingMapping::RingMapping(usize size, RingMode mode) :
+            _mode {mode},
+            _address {nullptr},
+            _size {0},
+            _handle {invalid_file_handle},
+            _cursors {std::make_unique<RingCursors>()} {
+        // Views have to be placed on allocation granularity boundaries, which is larger than a page
+        SYSTEM_INFO info {};
+        ::GetSystemInfo(&info);
+        _size = MappingRange {0, size}.align_to(static_cast<usize>(info.dwAllocationGranularity)).size;
+
+        if(_size == 0) {
+            throw std::runtime_error {"Could not create ring mapping: size must not be zero"};
+        }
+
+        const auto size_high = static_cast<DWORD>(static_cast<u64>(_size) >> 32);
+        const auto size_low = static_cast<DWORD>(static_cast<u64>(_size) & 0xFFFFFFFFU);
+        _handle = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, size_high, size_low, nullptr);
+
+        if(_handle == nullptr) {
+            _handle = invalid_file_handle;
+            throw std::runtime_error {fmt::format("Could not create ring memory: {}", get_last_error())};
+        }
+
+        // Find a free range of twice the size, then map the same section into both halves of it.
+        // Another thread may grab the range after it was released again, so retry a few times.
+        for(usize attempt = 0; attempt < max_ring_map_attempts && _address == nullptr; ++attempt) {
+            auto* address = static_cast<u8*>(::VirtualAlloc(nullptr, _size << 1, MEM_RESERVE, PAGE_NOACCESS));
+
+            if(address == nullptr) {
+                break;
+            }
+
+            ::VirtualFree(address, 0, MEM_RELEASE);
+            auto* first_view = ::MapViewOfFileEx(_handle, FILE_MAP_ALL_ACCESS, 0, 0, _size, address);
+
+            if(first_view == nullptr) {
+                continue;
+            }
+
+            auto* second_view = ::MapViewOfFileEx(_handle, FILE_MAP_ALL_ACCESS, 0, 0, _size, address + _size);
+
+            if(second_view == nullptr) {
+                ::UnmapViewOfFile(first_view);
+                continue;
+            }
+
+            _address = first_view;
+        }
+
+        if(_address == nullptr) {
+            const auto error = get_last_error();
+            ::CloseHandle(_handle);
+            throw std::runtime_error {fmt::format("Could not map ring memory: {}", error)};
+        }
+    }
+
+    RingMapping::~RingMapping() noexcept {
+        if(_address != nullptr) {
+            ::UnmapViewOfFile(static_cast<u8*>(_address) + _size);// NOLINT
+            ::UnmapViewOfFile(_address);
+        }
+
+        if(_handle.is_valid()) {
+            ::CloseHandle(_handle);
+        }
+    }
+
+    auto RingMapping::operator=(RingMapping&& other) noexcept -> RingMapping& {
+        if(this == &other) {
+            return *this;
+        }
+
+        RingMapping previous {std::move(*this)};// Releases our current ring at the end of the scope
+        _mode = other._mode;
+        _address = other._address;
+        _size = other._size;
+        _handle = other._handle;
+        _cursors = std::move(other._cursors);
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+        return *this;
+    }
+
+    auto RingMapping::resize([[maybe_unused]] usize size) noexcept -> Result<void> {
+        return Error {std::string("Could not resize ring mapping: rings have a fixed size")};
+    }
+
+    auto RingMapping::sync() noexcept -> Result<void> {
+        return {};// Rings are not backed by a file, so there is nothing to write back
+    }
+
+    auto RingMapping::get_type() const noexcept -> MappingType {
+        return MappingType::RING;
+    }
+
+    auto RingMapping::get_access() const noexcept -> MappingAccess {
+        return MappingAccess::READ | MappingAccess::WRITE;
+    }
+
+    auto RingMapping::get_address() const noexcept -> void* {
+        return _address;
+    }
+
+    auto RingMapping::get_size() const noexcept -> usize {
+        return _size;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_WINDOWS
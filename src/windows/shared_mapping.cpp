@@ -0,0 +1,201 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_WINDOWS
+
+#include "kstd/platform/shared_mapping.hpp"
+
+#include <kstd/utils.hpp>
+
+namespace kstd::platform::mm {
+    [[nodiscard]] static auto get_object_name(const std::string& name) noexcept -> std::wstring {
+        return utils::to_wcs(fmt::format("Local\\{}", name));
+    }
+
+    [[nodiscard]] static auto get_view_access(MappingAccess access) noexcept -> DWORD {
+        return (access & MappingAccess::WRITE) == MappingAccess::WRITE ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ;
+    }
+
+    [[nodiscard]] static auto get_view_size(void* address) noexcept -> usize {
+        MEMORY_BASIC_INFORMATION info {};
+        ::VirtualQuery(address, &info, sizeof(MEMORY_BASIC_INFORMATION));
+        return static_cast<usize>(info.RegionSize);
+    }
+
+    SharedMapping::SharedMapping(SharedMapping&& other) noexcept :
+            _name {std::move(other._name)},
+            _access {other._access},
+            _address {other._address},
+            _size {other._size},
+            _handle {other._handle},
+            _is_owner {other._is_owner} {
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+        other._is_owner = false;
+    }
+
+    SharedMapping::SharedMapping() noexcept :
+            _access {MappingAccess::NONE},
+            _address {nullptr},
+            _size {0},
+            _handle {invalid_file_handle},
+            _is_owner {false} {
+    }
+
+    SharedMapping::SharedMapping(std::string name, MappingAccess access, SharedMode mode, usize size) :
+            _name {std::move(name)},
+            _access {access},
+            _address {nullptr},
+            _size {0},
+            _handle {invalid_file_handle},
+            _is_owner {false} {
+        const auto object_name = get_object_name(_name);
+
+        if(mode == SharedMode::CREATE && size == 0) {
+            throw std::runtime_error {fmt::format("Could not create shared memory {}: size must not be zero", _name)};
+        }
+
+        // Without a size we can only open an existing section
+        if(mode != SharedMode::OPEN && size != 0) {
+            const auto size_high = static_cast<DWORD>(static_cast<u64>(size) >> 32);
+            const auto size_low = static_cast<DWORD>(static_cast<u64>(size) & 0xFFFFFFFFU);
+            auto handle = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, size_high, size_low,
+                                               object_name.c_str());
+
+            if(handle == nullptr) {
+                throw std::runtime_error {
+                        fmt::format("Could not create shared memory {}: {}", _name, get_last_error())};
+            }
+
+            _is_owner = ::GetLastError() != ERROR_ALREADY_EXISTS;
+
+            if(!_is_owner && mode == SharedMode::CREATE) {
+                ::CloseHandle(handle);
+                throw std::runtime_error {fmt::format("Could not create shared memory {}: already exists", _name)};
+            }
+
+            _handle = handle;
+        }
+        else {
+            auto handle = ::OpenFileMappingW(get_view_access(_access), FALSE, object_name.c_str());
+
+            if(handle == nullptr) {
+                throw std::runtime_error {fmt::format("Could not open shared memory {}: {}", _name, get_last_error())};
+            }
+
+            _handle = handle;
+        }
+
+        _address = ::MapViewOfFile(_handle, get_view_access(_access), 0, 0, 0);
+
+        if(_address == nullptr) {
+            const auto error = get_last_error();
+            ::CloseHandle(_handle);
+            throw std::runtime_error {fmt::format("Could not map shared memory {}: {}", _name, error)};
+        }
+
+        // Sections are always sized in whole pages, so we can only validate the page-aligned size here
+        _size = _is_owner ? size : get_view_size(_address);
+
+        if(_size < size) {
+            ::UnmapViewOfFile(_address);
+            ::CloseHandle(_handle);
+            throw std::runtime_error {
+                    fmt::format("Could not open shared memory {}: size {} is not available", _name, size)};
+        }
+    }
+
+    SharedMapping::SharedMapping(file::FileHandle handle, MappingAccess access) :
+            _access {access},
+            _address {nullptr},
+            _size {0},
+            _handle {handle},
+            _is_owner {false} {
+        _address = ::MapViewOfFile(_handle, get_view_access(_access), 0, 0, 0);
+
+        // We own the handle, so it has to be closed when we throw, since no destructor will run
+        if(_address == nullptr) {
+            const auto error = get_last_error();
+            ::CloseHandle(_handle);
+            throw std::runtime_error {fmt::format("Could not map shared memory: {}", error)};
+        }
+
+        _size = get_view_size(_address);
+    }
+
+    SharedMapping::~SharedMapping() noexcept {
+        if(_address != nullptr) {
+            ::UnmapViewOfFile(_address);
+        }
+
+        if(_handle.is_valid()) {
+            ::CloseHandle(_handle);
+        }
+    }
+
+    auto SharedMapping::operator=(SharedMapping&& other) noexcept -> SharedMapping& {
+        if(this == &other) {
+            return *this;
+        }
+
+        SharedMapping previous {std::move(*this)};// Releases our current mapping at the end of the scope
+        _name = std::move(other._name);
+        _access = other._access;
+        _address = other._address;
+        _size = other._size;
+        _handle = other._handle;
+        _is_owner = other._is_owner;
+        other._address = nullptr;
+        other._size = 0;
+        other._handle = invalid_file_handle;
+        other._is_owner = false;
+        return *this;
+    }
+
+    auto SharedMapping::unlink(const std::string& name) noexcept -> Result<void> {
+        return {};// Named sections are removed with their last handle on Windows
+    }
+
+    auto SharedMapping::resize([[maybe_unused]] usize size) noexcept -> Result<void> {
+        return Error {fmt::format("Could not resize shared memory {}: size is fixed by its creator", _name)};
+    }
+
+    auto SharedMapping::sync() noexcept -> Result<void> {
+        return {};// Shared memory is not backed by a file, so there is nothing to write back
+    }
+
+    auto SharedMapping::get_type() const noexcept -> MappingType {
+        return MappingType::SHARED;
+    }
+
+    auto SharedMapping::get_access() const noexcept -> MappingAccess {
+        return _access;
+    }
+
+    auto SharedMapping::get_address() const noexcept -> void* {
+        return _address;
+    }
+
+    auto SharedMapping::get_size() const noexcept -> usize {
+        return _size;
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_WINDOWS
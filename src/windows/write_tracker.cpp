@@ -0,0 +1,192 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_WINDOWS
+
+#include "kstd/platform/write_tracker.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <thread>
+
+namespace kstd::platform::mm {
+    static constexpr usize max_tracked_regions = 64;
+
+    // Fault handlers count themselves in while they use the region, so it is only freed once they are done
+    struct TrackedSlot final {
+        std::atomic<TrackedRegion*> region;
+        std::atomic<usize> user_count;
+    };
+
+    static std::array<TrackedSlot, max_tracked_regions> s_tracked_slots {};// NOLINT
+    static std::once_flag s_install_flag {};                               // NOLINT
+
+    [[nodiscard]] static auto get_native_protection(MappingAccess access, bool is_writable) noexcept -> DWORD {
+        const auto is_executable = (access & MappingAccess::EXECUTE) == MappingAccess::EXECUTE;
+
+        if(is_writable && (access & MappingAccess::WRITE) == MappingAccess::WRITE) {
+            return is_executable ? PAGE_EXECUTE_READWRITE : PAGE_READWRITE;
+        }
+
+        return is_executable ? PAGE_EXECUTE_READ : PAGE_READONLY;
+    }
+
+    [[nodiscard]] static auto resolve_write_fault(void* address) noexcept -> bool {
+        auto* fault_address = static_cast<u8*>(address);
+
+        for(auto& slot : s_tracked_slots) {
+            ++slot.user_count;
+            const auto* region = slot.region.load();
+
+            if(region == nullptr || fault_address < region->address ||
+               fault_address >= region->address + region->size) {// NOLINT
+                --slot.user_count;
+                continue;
+            }
+
+            const auto page = static_cast<usize>(fault_address - region->address) / region->page_size;
+            constexpr usize bits_per_word = sizeof(u64) << 3;
+            region->dirty_words[page / bits_per_word].fetch_or(u64 {1} << (page % bits_per_word));// NOLINT
+
+            auto* page_address = region->address + page * region->page_size;// NOLINT
+            DWORD old_protection = 0;
+            const auto protection = get_native_protection(region->access, true);
+            const auto is_writable =
+                    ::VirtualProtect(page_address, region->page_size, protection, &old_protection) != 0;
+            --slot.user_count;
+            return is_writable;
+        }
+
+        return false;
+    }
+
+    static auto CALLBACK handle_write_fault(PEXCEPTION_POINTERS exception) noexcept -> LONG {
+        const auto* record = exception->ExceptionRecord;
+
+        // The first parameter of an access violation is 1 for writes, the second one is the target address
+        if(record->ExceptionCode != EXCEPTION_ACCESS_VIOLATION || record->NumberParameters < 2 ||
+           record->ExceptionInformation[0] != 1) {
+            return EXCEPTION_CONTINUE_SEARCH;
+        }
+
+        const auto is_resolved = resolve_write_fault(reinterpret_cast<void*>(record->ExceptionInformation[1]));// NOLINT
+
+        return is_resolved ? EXCEPTION_CONTINUE_EXECUTION : EXCEPTION_CONTINUE_SEARCH;
+    }
+
+    static auto install_fault_handler() noexcept -> void {
+        ::AddVectoredExceptionHandler(1, handle_write_fault);
+    }
+
+    WriteTracker::WriteTracker(WriteTracker&& other) noexcept :
+            _region {std::move(other._region)} {
+    }
+
+    WriteTracker::WriteTracker() noexcept :
+            _region {} {
+    }
+
+    WriteTracker::WriteTracker(void* address, usize size, MappingAccess access, DirtyPageMap& dirty_pages) :
+            _region {std::make_unique<TrackedRegion>(TrackedRegion {static_cast<u8*>(address), size,
+                                                                    dirty_pages.get_page_size(), access,
+                                                                    dirty_pages.get_data()})} {
+        if(dirty_pages.get_size() < size) {
+            throw std::runtime_error {"Could not track writes: dirty page map is smaller than the region"};
+        }
+
+        std::call_once(s_install_flag, install_fault_handler);
+
+        const auto slot = std::find_if(s_tracked_slots.begin(), s_tracked_slots.end(), [this](auto& slot) {
+            TrackedRegion* expected = nullptr;
+            return slot.region.compare_exchange_strong(expected, _region.get());
+        });
+
+        if(slot == s_tracked_slots.end()) {
+            throw std::runtime_error {
+                    fmt::format("Could not track writes: at most {} regions can be tracked", max_tracked_regions)};
+        }
+
+        DWORD old_protection = 0;
+
+        if(!::VirtualProtect(address, size, get_native_protection(access, false), &old_protection)) {
+            slot->region.store(nullptr);
+            throw std::runtime_error {fmt::format("Could not write-protect region: {}", get_last_error())};
+        }
+    }
+
+    WriteTracker::~WriteTracker() noexcept {
+        if(_region == nullptr) {
+            return;
+        }
+
+        // Make the region writable before unregistering it, so no write can fault without a handler
+        DWORD old_protection = 0;
+        ::VirtualProtect(_region->address, _region->size, get_native_protection(_region->access, true),
+                         &old_protection);
+
+        for(auto& slot : s_tracked_slots) {
+            auto* expected = _region.get();
+
+            if(!slot.region.compare_exchange_strong(expected, nullptr)) {
+                continue;
+            }
+
+            while(slot.user_count.load() != 0) {
+                std::this_thread::yield();// Wait for handlers which may still reference the region
+            }
+
+            break;
+        }
+    }
+
+    auto WriteTracker::operator=(WriteTracker&& other) noexcept -> WriteTracker& {
+        if(this == &other) {
+            return *this;
+        }
+
+        WriteTracker previous {std::move(*this)};// Releases our current region at the end of the scope
+        _region = std::move(other._region);
+        return *this;
+    }
+
+    auto WriteTracker::protect(MappingRange range) noexcept -> Result<void> {
+        if(_region == nullptr) {
+            return {};
+        }
+
+        if(!range.is_within(_region->size)) {
+            return Error {fmt::format("Could not write-protect range {}..{}: exceeds region size {}", range.offset,
+                                      range.get_end(), _region->size)};
+        }
+
+        const auto aligned_range = range.align_to(_region->page_size);
+        auto* address = _region->address + aligned_range.offset;// NOLINT
+        DWORD old_protection = 0;
+
+        if(!::VirtualProtect(address, aligned_range.size, get_native_protection(_region->access, false),
+                             &old_protection)) {
+            return Error {fmt::format("Could not write-protect range: {}", get_last_error())};
+        }
+
+        return {};
+    }
+}// namespace kstd::platform::mm
+
+#endif// PLATFORM_WINDOWS
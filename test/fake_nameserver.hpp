@@ -0,0 +1,134 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#ifdef PLATFORM_LINUX
+
+#include <arpa/inet.h>
+#include <array>
+#include <fmt/format.h>
+#include <kstd/types.hpp>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <string_view>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Answers A queries with 10.0.0.1, or with 10.0.0.0 plus the number for names starting
+// with a number. Ignores names starting with drop and truncates the ones starting with
+// big over UDP, which get six addresses over TCP instead
+class FakeNameserver final {
+    int _udp_fd;
+    int _tcp_fd;
+    int _stop_fd;
+    kstd::u16 _port;
+    std::thread _thread;
+
+    [[nodiscard]] static auto make_response(const kstd::u8* query, kstd::usize size, bool is_tcp)
+            -> std::vector<kstd::u8> {
+        std::vector<kstd::u8> response {query, query + size};
+        const auto is_big = size > 15 && std::string_view {reinterpret_cast<const char*>(query + 13), 3} == "big";
+        const kstd::u8 answer_count = is_big ? (is_tcp ? 6 : 0) : 1;
+        const auto label = std::string_view {reinterpret_cast<const char*>(query + 13), query[12]};
+        const auto is_numeric = !label.empty() && label.find_first_not_of("0123456789") == std::string_view::npos;
+        const auto number = is_numeric ? std::stoul(std::string {label}) : 1;
+        response[2] = is_big && !is_tcp ? 0x83 : 0x81;
+        response[3] = 0x80;
+        response[7] = answer_count;
+
+        for(kstd::u8 index = 0; index < answer_count; ++index) {
+            const auto address = number + index;
+            response.insert(response.end(), {0xC0, 0x0C, 0, 1, 0, 1, 0, 0, 0, 60, 0, 4, 10,
+                                             static_cast<kstd::u8>(address >> 16U),
+                                             static_cast<kstd::u8>(address >> 8U), static_cast<kstd::u8>(address)});
+        }
+
+        return response;
+    }
+
+    auto run() -> void {
+        std::array<pollfd, 3> fds {{{_udp_fd, POLLIN, 0}, {_tcp_fd, POLLIN, 0}, {_stop_fd, POLLIN, 0}}};
+        std::array<kstd::u8, 512> buffer {};
+
+        while(::poll(fds.data(), fds.size(), -1) > 0 && fds[2].revents == 0) {
+            if(fds[0].revents != 0) {
+                sockaddr_in source {};
+                socklen_t source_size = sizeof(source);
+                const auto size = ::recvfrom(_udp_fd, buffer.data(), buffer.size(), 0,
+                                             reinterpret_cast<sockaddr*>(&source), &source_size);
+
+                if(size > 15 && std::string_view {reinterpret_cast<const char*>(buffer.data() + 13), 4} != "drop") {
+                    const auto response = make_response(buffer.data(), static_cast<kstd::usize>(size), false);
+                    ::sendto(_udp_fd, response.data(), response.size(), 0, reinterpret_cast<sockaddr*>(&source),
+                             source_size);
+                }
+            }
+
+            if(fds[1].revents != 0) {
+                const auto connection = ::accept(_tcp_fd, nullptr, nullptr);
+                std::array<kstd::u8, 2> length {};
+                ::recv(connection, length.data(), length.size(), MSG_WAITALL);
+                const auto size = ::recv(connection, buffer.data(), (length[0] << 8U) | length[1], MSG_WAITALL);
+                auto response = make_response(buffer.data(), static_cast<kstd::usize>(size), true);
+                response.insert(response.begin(), {static_cast<kstd::u8>(response.size() >> 8U),
+                                                   static_cast<kstd::u8>(response.size())});
+                ::send(connection, response.data(), response.size(), MSG_NOSIGNAL);
+                ::close(connection);
+            }
+        }
+    }
+
+    public:
+    FakeNameserver() :
+            _udp_fd {::socket(AF_INET, SOCK_DGRAM, 0)},
+            _tcp_fd {::socket(AF_INET, SOCK_STREAM, 0)},
+            _stop_fd {::eventfd(0, 0)},
+            _port {0} {
+        sockaddr_in address {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t address_size = sizeof(address);
+        ::bind(_udp_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        ::getsockname(_udp_fd, reinterpret_cast<sockaddr*>(&address), &address_size);
+        ::bind(_tcp_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        ::listen(_tcp_fd, 16);
+        _port = ntohs(address.sin_port);
+        _thread = std::thread {[this] { run(); }};
+    }
+
+    ~FakeNameserver() {
+        const kstd::u64 value = 1;
+        ::write(_stop_fd, &value, sizeof(value));
+        _thread.join();
+        ::close(_udp_fd);
+        ::close(_tcp_fd);
+        ::close(_stop_fd);
+    }
+
+    [[nodiscard]] auto get_address() const -> std::string {
+        return fmt::format("127.0.0.1:{}", _port);
+    }
+};
+
+#endif// PLATFORM_LINUX
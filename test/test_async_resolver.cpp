@@ -0,0 +1,113 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include "fake_nameserver.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <kstd/platform/async_resolver.hpp>
+#include <thread>
+#include <vector>
+
+TEST(kstd_platform_AsyncResolver, test_resolve_concurrently) {
+    using namespace kstd::platform;
+
+    FakeNameserver nameserver {};
+    AsyncResolver resolver {{nameserver.get_address()}, std::chrono::milliseconds {200}, 5};
+    std::vector<std::future<kstd::Result<DnsAnswer>>> futures {};
+
+    for(auto index = 0; index < 1000; ++index) {
+        futures.push_back(resolver.resolve(fmt::format("host{}.example", index), RecordType::A));
+    }
+
+    for(auto& future : futures) {
+        const auto answer = future.get().get_or_throw();
+        ASSERT_EQ(answer.addresses.size(), 1);
+        ASSERT_EQ(answer.addresses[0].to_string(), "10.0.0.1");
+        ASSERT_EQ(answer.ttl, 60);
+    }
+
+    std::atomic<bool> is_done {false};
+    resolver.resolve("illegal..example", RecordType::A, [&](kstd::Result<DnsAnswer> result) {
+        ASSERT_FALSE(result);
+        is_done = true;
+    });
+
+    while(!is_done) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(resolver.get_statistics().pending_count, 0);
+    ASSERT_GE(resolver.get_statistics().query_count, 1000);// Bursts may overflow the socket of the nameserver
+}
+
+TEST(kstd_platform_AsyncResolver, test_timeout) {
+    using namespace kstd::platform;
+
+    FakeNameserver nameserver {};
+    AsyncResolver resolver {{nameserver.get_address()}, std::chrono::milliseconds {50}, 2};
+    ASSERT_FALSE(resolver.resolve("drop.example", RecordType::A).get());
+
+    const auto statistics = resolver.get_statistics();
+    ASSERT_EQ(statistics.query_count, 2);
+    ASSERT_EQ(statistics.retry_count, 1);
+    ASSERT_EQ(statistics.timeout_count, 2);
+}
+
+TEST(kstd_platform_AsyncResolver, test_truncated_over_tcp) {
+    using namespace kstd::platform;
+
+    FakeNameserver nameserver {};
+    AsyncResolver resolver {{nameserver.get_address()}};
+    const auto answer = resolver.resolve("big.example", RecordType::A).get().get_or_throw();
+    ASSERT_EQ(answer.addresses.size(), 6);
+    ASSERT_EQ(answer.addresses[5].to_string(), "10.0.0.6");
+    ASSERT_EQ(resolver.get_statistics().truncated_count, 1);
+}
+
+TEST(kstd_platform_AsyncResolver, test_backlog_of_illegal_names) {
+    using namespace kstd::platform;
+
+    FakeNameserver nameserver {};
+    AsyncResolver resolver {{nameserver.get_address()}, std::chrono::milliseconds {1000}, 1};
+    std::atomic<kstd::usize> failed_count {0};
+    const auto on_result = [&failed_count](kstd::Result<DnsAnswer> result) {
+        if(!result) {
+            ++failed_count;
+        }
+    };
+
+    // Fill every query ID, so the illegal names wait in the backlog until these time out
+    for(auto index = 0; index < 0x10000; ++index) {
+        resolver.resolve("drop.example", RecordType::A, on_result);
+    }
+
+    for(auto index = 0; index < 200000; ++index) {
+        resolver.resolve("illegal..example", RecordType::A, on_result);
+    }
+
+    while(failed_count != 0x10000 + 200000) {
+        std::this_thread::sleep_for(std::chrono::milliseconds {1});
+    }
+
+    ASSERT_EQ(resolver.get_statistics().pending_count, 0);
+}
+
+#endif// PLATFORM_LINUX
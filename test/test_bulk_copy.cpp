@@ -0,0 +1,79 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/platform/bulk_copy.hpp>
+#include <kstd/platform/virtual_arena.hpp>
+#include <vector>
+
+TEST(kstd_platform_BulkCopy, test_stream_copy_fill) {
+    using namespace kstd::platform;
+
+    constexpr kstd::usize max_size = 1024 * 1024 + 77;
+    std::vector<kstd::u8> source(max_size + 64);
+    std::vector<kstd::u8> destination(max_size + 64);
+
+    for(kstd::usize index = 0; index < source.size(); ++index) {
+        source[index] = static_cast<kstd::u8>(index * 31 + 7);
+    }
+
+#ifdef KSTD_STREAMING_X86
+    ASSERT_NE(mm::get_streaming_isa(), mm::StreamingIsa::NONE);// Every x86 CPU since SSE2 can stream
+#endif
+
+    const mm::StreamingIsa isas[] = {mm::StreamingIsa::NONE, mm::StreamingIsa::SSE2, mm::StreamingIsa::AVX2,// NOLINT
+                                     mm::StreamingIsa::AVX512};
+
+    for(const auto isa : isas) {
+        for(const kstd::usize size : {0, 1, 15, 100, 4097, 65536 + 3, static_cast<int>(max_size)}) {
+            // Misalign both ends, so the head and tail paths are exercised too
+            std::fill(destination.begin(), destination.end(), 0);
+            mm::stream_copy(destination.data() + 3, source.data() + 5, size, isa);
+            ASSERT_EQ(std::memcmp(destination.data() + 3, source.data() + 5, size), 0);
+            ASSERT_EQ(destination[size + 3], 0);
+
+            std::fill(destination.begin(), destination.end(), 0);
+            mm::stream_fill(destination.data() + 9, 0xA5, size, isa);
+            ASSERT_EQ(std::count(destination.begin(), destination.end(), 0xA5), size);
+            ASSERT_EQ(destination[8], 0);
+            ASSERT_EQ(destination[size + 9], 0);
+        }
+    }
+}
+
+TEST(kstd_platform_BulkCopy, test_mapping) {
+    using namespace kstd::platform;
+
+    constexpr kstd::usize size = 4 * 1024 * 1024;
+    mm::VirtualArena arena {size};
+    ASSERT_TRUE(arena.allocate(size));
+    std::vector<kstd::u8> source(size / 2, 0x42);
+
+    ASSERT_TRUE(mm::bulk_copy(arena, 16, source.data(), source.size()));
+    ASSERT_TRUE(mm::bulk_fill(arena, {16 + source.size(), 100}, 0x17));
+
+    const auto* data = static_cast<const kstd::u8*>(arena.get_address());
+    ASSERT_EQ(data[15], 0);
+    ASSERT_EQ(data[16], 0x42);
+    ASSERT_EQ(data[15 + source.size()], 0x42);
+    ASSERT_EQ(data[16 + source.size()], 0x17);
+
+    ASSERT_FALSE(mm::bulk_copy(arena, size - 1, source.data(), 2));
+    ASSERT_FALSE(mm::bulk_fill(arena, {size, 1}, 0));
+}
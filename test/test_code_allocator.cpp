@@ -0,0 +1,109 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <kstd/platform/code_allocator.hpp>
+#include <vector>
+
+#if defined(CPU_X86_64) || defined(__x86_64__) || defined(_M_X64)
+// mov eax, 42; ret
+static constexpr kstd::u8 return_42[] = {0xB8, 0x2A, 0x00, 0x00, 0x00, 0xC3};// NOLINT
+#elif defined(__aarch64__) || defined(_M_ARM64)
+// mov w0, #42; ret
+static constexpr kstd::u8 return_42[] = {0x40, 0x05, 0x80, 0x52, 0xC0, 0x03, 0x5F, 0xD6};// NOLINT
+#endif
+
+TEST(kstd_platform_CodeAllocator, test_allocate) {
+    using namespace kstd::platform;
+
+    mm::CodeAllocator allocator {get_page_size()};
+    ASSERT_FALSE(allocator.allocate(0));
+    ASSERT_FALSE(allocator.allocate(16, 3));
+
+    auto first_block = allocator.allocate(10);
+    ASSERT_TRUE(first_block);
+    ASSERT_NE(static_cast<const void*>(first_block->writable), static_cast<const void*>(first_block->executable));
+
+    auto second_block = allocator.allocate(10, 64);
+    ASSERT_TRUE(second_block);
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(second_block->executable) % 64, 0);// NOLINT
+    ASSERT_EQ(allocator.get_chunks().size(), 1);
+    ASSERT_EQ(allocator.get_pending_size(), 74);
+
+    auto large_block = allocator.allocate(get_page_size() + 1);
+    ASSERT_TRUE(large_block);
+    ASSERT_EQ(allocator.get_chunks().size(), 2);
+    ASSERT_TRUE(allocator.finalize());
+    ASSERT_EQ(allocator.get_pending_size(), 0);
+
+    allocator.reset();
+    ASSERT_EQ(allocator.get_chunks().size(), 1);
+    ASSERT_EQ(allocator.get_used_size(), 0);
+}
+
+TEST(kstd_platform_CodeAllocator, test_deallocate) {
+    using namespace kstd::platform;
+
+    mm::CodeAllocator allocator {get_page_size()};
+    auto first_block = allocator.allocate(24);
+    ASSERT_TRUE(first_block);
+    auto second_block = allocator.allocate(24);
+    ASSERT_TRUE(second_block);
+    ASSERT_TRUE(allocator.finalize());
+
+    allocator.deallocate(*first_block);
+    ASSERT_EQ(allocator.get_used_size(), 32);// Both blocks start 16 byte aligned
+
+    auto reused_block = allocator.allocate(20);
+    ASSERT_TRUE(reused_block);
+    ASSERT_EQ(reused_block->executable, first_block->executable);
+    ASSERT_EQ(reused_block->size, 24);
+    ASSERT_EQ(allocator.get_used_size(), 56);
+    ASSERT_EQ(allocator.get_pending_size(), 24);// The reused block has to be flushed again
+    ASSERT_TRUE(allocator.finalize());
+    ASSERT_EQ(allocator.get_pending_size(), 0);
+
+    allocator.deallocate(*second_block);
+    auto larger_block = allocator.allocate(40);// Too large for the free block, so it is bumped instead
+    ASSERT_TRUE(larger_block);
+    ASSERT_NE(larger_block->executable, second_block->executable);
+}
+
+#if defined(CPU_X86_64) || defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)
+TEST(kstd_platform_CodeAllocator, test_execute) {
+    using namespace kstd::platform;
+
+    mm::CodeAllocator allocator {};
+    std::vector<mm::CodeBlock> blocks {};
+
+    for(kstd::usize index = 0; index < 1000; ++index) {
+        auto block = allocator.allocate(sizeof(return_42));
+        ASSERT_TRUE(block);
+        std::memcpy(block->writable, return_42, sizeof(return_42));
+        blocks.push_back(*block);
+    }
+
+    ASSERT_TRUE(allocator.finalize());
+
+    for(const auto& block : blocks) {
+        ASSERT_EQ(block.get_function<int()>()(), 42);
+    }
+}
+#endif
@@ -17,14 +17,19 @@
  * @since 12/08/2023
  */
 
+#include "fake_nameserver.hpp"
 #include "kstd/platform/dns.hpp"
+#include <chrono>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <thread>
 
 TEST(kstd_platform_Resolver, test_resolve_local_addresses) {
     auto resolver = kstd::platform::Resolver {};
-    ASSERT_EQ(resolver.resolve("localhost", kstd::platform::RecordType::A).get_or_throw(), "127.0.0.1");
-    ASSERT_EQ(resolver.resolve("localhost", kstd::platform::RecordType::AAAA).get_or_throw(), "::1");
+    ASSERT_EQ(resolver.resolve("localhost", kstd::platform::RecordType::A).get_or_throw().addresses[0].to_string(),
+              "127.0.0.1");
+    ASSERT_EQ(resolver.resolve("localhost", kstd::platform::RecordType::AAAA).get_or_throw().addresses[0].to_string(),
+              "::1");
 }
 
 TEST(kstd_platform_Resolver, test_resolve_remote_addresses) {
@@ -44,3 +49,94 @@ TEST(kstd_platform_Resolver, test_resolve_with_invalid_nameservers) {
     auto resolver = kstd::platform::Resolver {{"1.2.3.4", "1.2.3.5"}};
     ASSERT_FALSE(resolver.resolve("google.com", kstd::platform::RecordType::A));
 }
+
+TEST(kstd_platform_Resolver, test_shared_cache) {
+    using namespace kstd::platform;
+
+    auto cache = std::make_shared<DnsCache<DnsAnswer>>();
+    cache->insert("shared.example", static_cast<kstd::u16>(RecordType::A), get_loopback_answer(false),
+                  std::chrono::seconds {60});
+
+    std::vector<std::thread> threads {};
+
+    for(auto index = 0; index < 4; ++index) {
+        threads.emplace_back([&cache] {
+            auto resolver = Resolver {};
+            resolver.set_cache(cache);
+            auto answer = resolver.resolve("shared.example", RecordType::A);
+            ASSERT_EQ(answer.get_or_throw().addresses[0].to_string(), "127.0.0.1");
+        });
+    }
+
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(cache->get_statistics().hit_count, 4);
+}
+
+#ifdef PLATFORM_LINUX
+
+TEST(kstd_platform_Resolver, test_resolve_many) {
+    using kstd::platform::RecordType;
+
+    FakeNameserver nameserver {};
+    auto resolver = kstd::platform::Resolver {{nameserver.get_address()}};
+    auto results = resolver.resolve_many({"localhost", "7.example", "8.example"}, {RecordType::A, RecordType::AAAA});
+    ASSERT_EQ(results.size(), 6);
+    ASSERT_EQ(results[0].get_or_throw().addresses[0].to_string(), "127.0.0.1");
+    ASSERT_EQ(results[1].get_or_throw().addresses[0].to_string(), "::1");
+    ASSERT_EQ(results[2].get_or_throw().addresses[0].to_string(), "10.0.0.7");
+    ASSERT_EQ(results[4].get_or_throw().addresses[0].to_string(), "10.0.0.8");
+    ASSERT_FALSE(results[3]);// The nameserver only knows A records
+    ASSERT_FALSE(results[5]);
+}
+
+TEST(kstd_platform_Resolver, test_resolve_many_pipelined) {
+    using namespace kstd::platform;
+
+    FakeNameserver nameserver {};
+    auto resolver = Resolver {{nameserver.get_address()}};
+    resolver.set_cache_capacity(0);
+    resolver.set_timeout(std::chrono::seconds {1}, 2);
+    std::vector<std::string> names {};
+
+    for(auto index = 0; index < 1000; ++index) {
+        names.push_back(fmt::format("{}.example", index));
+    }
+
+    names.emplace_back("big.example");
+    names.emplace_back("drop.example");
+
+    // A small window keeps most names waiting for a free slot
+    auto results = resolver.resolve_many(names, {RecordType::A}, 16);
+    ASSERT_EQ(results.size(), names.size());
+
+    for(auto index = 0; index < 1000; ++index) {
+        const auto expected = fmt::format("10.0.{}.{}", index >> 8, index & 0xFF);
+        ASSERT_EQ(results[index].get_or_throw().addresses[0].to_string(), expected);
+    }
+
+    ASSERT_EQ(results[1000].get_or_throw().addresses.size(), 6);// Truncated, so repeated over TCP
+    ASSERT_FALSE(results[1001]);
+    ASSERT_NE(results[1001].get_error().find("Timed out"), std::string::npos);
+}
+
+TEST(kstd_platform_Resolver, test_resolve_many_illegal_names) {
+    using namespace kstd::platform;
+
+    FakeNameserver nameserver {};
+    auto resolver = Resolver {{nameserver.get_address()}};
+    const auto start = std::chrono::steady_clock::now();
+    auto results = resolver.resolve_many({"illegal..example", "also..illegal"}, {RecordType::A, RecordType::AAAA});
+    ASSERT_EQ(results.size(), 4);
+
+    for(auto& result : results) {
+        ASSERT_FALSE(result);
+    }
+
+    // Nothing was ever sent, so there is nothing to wait for
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds {1});
+}
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,94 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#include "kstd/platform/dns_cache.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+TEST(kstd_platform_DnsCache, test_find_insert) {
+    kstd::platform::DnsCache<std::string> cache {};
+    ASSERT_FALSE(cache.find("example.com", 1));
+
+    cache.insert("example.com", 1, "93.184.216.34", std::chrono::seconds {60});
+    cache.insert("example.com", 28, "2606:2800:220:1::", std::chrono::seconds {0});// Zero TTLs are never cached
+    cache.insert_negative("missing.example.com", 1, "NXDOMAIN", std::chrono::seconds {60});
+
+    ASSERT_EQ(cache.find("example.com", 1)->result.get_or_throw(), "93.184.216.34");
+    ASSERT_FALSE(cache.find("example.com", 28));
+    ASSERT_FALSE(cache.find("missing.example.com", 1)->result);
+
+    const auto statistics = cache.get_statistics();
+    ASSERT_EQ(statistics.hit_count, 2);
+    ASSERT_EQ(statistics.negative_hit_count, 1);
+    ASSERT_EQ(statistics.miss_count, 2);
+    ASSERT_EQ(statistics.size, 2);
+    ASSERT_EQ(statistics.get_hit_ratio(), 0.5);
+}
+
+TEST(kstd_platform_DnsCache, test_expiry_and_eviction) {
+    kstd::platform::DnsCache<int> cache {4, 1, std::chrono::seconds {1}};
+    ASSERT_EQ(cache.get_capacity(), 4);
+
+    cache.insert("a", 1, 1, std::chrono::seconds {3600});// Shortened to the maximum TTL
+    std::this_thread::sleep_for(std::chrono::milliseconds {1100});
+    ASSERT_FALSE(cache.find("a", 1));
+
+    for(auto index = 0; index < 4; ++index) {
+        cache.insert(std::to_string(index), 1, index, std::chrono::seconds {1});
+    }
+
+    ASSERT_TRUE(cache.find("0", 1));// Makes 1 the least recently used entry
+    cache.insert("4", 1, 4, std::chrono::seconds {1});
+
+    ASSERT_FALSE(cache.find("1", 1));
+    ASSERT_EQ(cache.find("0", 1)->result.get_or_throw(), 0);
+    ASSERT_EQ(cache.find("4", 1)->result.get_or_throw(), 4);
+    ASSERT_EQ(cache.get_statistics().eviction_count, 1);
+
+    cache.clear();
+    ASSERT_EQ(cache.get_statistics().size, 0);
+}
+
+TEST(kstd_platform_DnsCache, test_case_insensitive_names) {
+    kstd::platform::DnsCache<int> cache {};
+    cache.insert("Example.COM", 1, 1, std::chrono::seconds {60});
+
+    ASSERT_EQ(cache.find("example.com", 1)->result.get_or_throw(), 1);
+    ASSERT_EQ(cache.find("EXAMPLE.com", 1)->result.get_or_throw(), 1);
+
+    cache.insert("example.com", 1, 2, std::chrono::seconds {60});// Replaces the entry instead of adding one
+    ASSERT_EQ(cache.find("Example.com", 1)->result.get_or_throw(), 2);
+    ASSERT_EQ(cache.get_statistics().size, 1);
+}
+
+TEST(kstd_platform_DnsCache, test_remaining_ttl) {
+    kstd::platform::DnsCache<int> cache {};
+    cache.insert("example.com", 1, 1, std::chrono::seconds {10});
+
+    auto hit = cache.find("example.com", 1);
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(hit->age.count(), 0);
+    ASSERT_LE(hit->remaining_ttl.count(), 10);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds {1100});
+    hit = cache.find("example.com", 1);
+    ASSERT_TRUE(hit);
+    ASSERT_GE(hit->age.count(), 1);
+    ASSERT_LE(hit->remaining_ttl.count(), 8);// Rounded down, as nearly a second of it has already passed
+}
@@ -0,0 +1,126 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since 18/10/2026
+ */
+
+#include "kstd/platform/dns_message.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+    auto append_u16(std::vector<kstd::u8>& message, kstd::u16 value) -> void {
+        message.push_back(static_cast<kstd::u8>(value >> 8U));
+        message.push_back(static_cast<kstd::u8>(value & 0xFFU));
+    }
+
+    auto append_u32(std::vector<kstd::u8>& message, kstd::u32 value) -> void {
+        append_u16(message, static_cast<kstd::u16>(value >> 16U));
+        append_u16(message, static_cast<kstd::u16>(value & 0xFFFFU));
+    }
+
+    auto append_record(std::vector<kstd::u8>& message, kstd::u16 type, kstd::u32 ttl,
+                       const std::vector<kstd::u8>& data) -> void {
+        append_u16(message, 0xC00C);// Points at the question name
+        append_u16(message, type);
+        append_u16(message, 1);
+        append_u32(message, ttl);
+        append_u16(message, static_cast<kstd::u16>(data.size()));
+        message.insert(message.end(), data.cbegin(), data.cend());
+    }
+
+    auto make_message(kstd::u16 flags, kstd::u16 answer_count, kstd::u16 authority_count, kstd::u16 type)
+            -> std::vector<kstd::u8> {
+        std::vector<kstd::u8> message {};
+        append_u16(message, 0x1234);
+        append_u16(message, flags);
+        append_u16(message, 1);
+        append_u16(message, answer_count);
+        append_u16(message, authority_count);
+        append_u16(message, 0);
+
+        for(const std::string label : {"www", "example", "com"}) {
+            message.push_back(static_cast<kstd::u8>(label.size()));
+            message.insert(message.end(), label.cbegin(), label.cend());
+        }
+
+        message.push_back(0);
+        append_u16(message, type);
+        append_u16(message, 1);
+        return message;
+    }
+}// namespace
+
+TEST(kstd_platform_DnsMessage, test_parse_addresses) {
+    using namespace kstd::platform;
+    auto message = make_message(0x8180, 6, 0, dns_type_a);
+
+    for(kstd::u8 index = 0; index < 6; ++index) {
+        append_record(message, dns_type_a, 300 - index, {10, 0, 0, index});
+    }
+
+    const auto answer = parse_dns_answer(message.data(), message.size(), dns_type_a).get_or_throw();
+    ASSERT_FALSE(answer.is_negative());
+    ASSERT_FALSE(answer.addresses.is_inline());
+    ASSERT_EQ(answer.addresses.size(), 6);
+    ASSERT_EQ(answer.addresses[5].to_string(), "10.0.0.5");
+    ASSERT_EQ(answer.addresses[5].to_ipv4().s_addr, htonl(0x0A000005));
+    ASSERT_EQ(answer.ttl, 295);
+}
+
+TEST(kstd_platform_DnsMessage, test_parse_cname_chain) {
+    using namespace kstd::platform;
+    auto message = make_message(0x8180, 2, 0, dns_type_aaaa);
+    append_record(message, dns_type_cname, 60, {3, 'c', 'd', 'n', 0xC0, 0x10});// cdn.example.com
+    append_record(message, dns_type_aaaa, 120, {0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1});
+
+    const auto answer = parse_dns_answer(message.data(), message.size(), dns_type_aaaa).get_or_throw();
+    ASSERT_TRUE(answer.addresses.is_inline());
+    ASSERT_EQ(answer.addresses.size(), 1);
+    ASSERT_TRUE(answer.addresses[0].is_ipv6());
+    ASSERT_EQ(answer.addresses[0].to_string(), "2001:db8::1");
+    ASSERT_EQ(answer.cnames, std::vector<std::string> {"cdn.example.com"});
+    ASSERT_EQ(answer.ttl, 60);
+}
+
+TEST(kstd_platform_DnsMessage, test_parse_negative) {
+    using namespace kstd::platform;
+    auto message = make_message(0x8183, 0, 1, dns_type_a);
+    std::vector<kstd::u8> soa {0xC0, 0x10, 0xC0, 0x10};// Primary nameserver and mailbox
+    for(const kstd::u32 field : {1U, 7200U, 900U, 1209600U, 120U}) {
+        for(auto shift = 24; shift >= 0; shift -= 8) {
+            soa.push_back(static_cast<kstd::u8>(field >> static_cast<kstd::u32>(shift)));
+        }
+    }
+    append_record(message, dns_type_soa, 600, soa);
+
+    const auto answer = parse_dns_answer(message.data(), message.size(), dns_type_a).get_or_throw();
+    ASSERT_TRUE(answer.is_negative());
+    ASSERT_EQ(answer.response_code, DnsResponseCode::NAME_ERROR);
+    ASSERT_EQ(answer.ttl, 120);
+}
+
+TEST(kstd_platform_DnsMessage, test_parse_malformed) {
+    using namespace kstd::platform;
+    auto message = make_message(0x8180, 1, 0, dns_type_a);
+    append_record(message, dns_type_a, 300, {10, 0, 0, 1});
+
+    ASSERT_FALSE(parse_dns_answer(message.data(), message.size() - 1, dns_type_a));
+    ASSERT_FALSE(parse_dns_answer(message.data(), 8, dns_type_a));
+
+    message[2] = 0x01;// A query instead of a response
+    ASSERT_FALSE(parse_dns_answer(message.data(), message.size(), dns_type_a));
+}
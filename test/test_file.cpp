@@ -17,10 +17,43 @@
  * @since 02/07/2023
  */
 
+#include <fstream>
 #include <gtest/gtest.h>
 #include <kstd/platform/file.hpp>
+#include <string>
 
 TEST(kstd_platform_File, test_open_close) {
     kstd::platform::file::File file("./test/test_file.bin", kstd::platform::file::FileMode::READ_WRITE);
     ASSERT_TRUE(file.get_handle().is_valid());
-}
\ No newline at end of file
+}
+#ifndef PLATFORM_WINDOWS
+TEST(kstd_platform_File, test_cache_residency) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+
+    {
+        std::ofstream stream("./test/test_file_8.bin", std::ios::binary | std::ios::trunc);
+        const std::string data(page_size * 4, 'A');
+        stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    file::File file("./test/test_file_8.bin", file::FileMode::READ);
+
+    auto residency = file.get_residency();
+    ASSERT_TRUE(residency);
+    ASSERT_EQ(residency->get_page_count(), 4);
+    ASSERT_TRUE(residency->is_fully_resident());// Freshly written data sits in the page cache
+
+    auto partial_residency = file.get_residency(page_size + 1, page_size);
+    ASSERT_TRUE(partial_residency);
+    ASSERT_EQ(partial_residency->get_page_count(), 2);
+
+    auto statistics = file.get_cache_statistics();
+    ASSERT_TRUE(statistics);
+    ASSERT_EQ(statistics->page_count, 4);
+    ASSERT_EQ(statistics->cached_page_count, 4);
+
+    ASSERT_FALSE(file.get_residency(page_size * 5));
+}
+#endif
@@ -29,4 +29,222 @@ TEST(kstd_platform_FileMapping, test_map_unmap) {
 #ifdef PLATFORM_WINDOWS
     ASSERT_TRUE(mapping.get_handle().is_valid());
 #endif
-}
\ No newline at end of file
+}
+
+TEST(kstd_platform_FileMapping, test_populate_and_advise) {
+    using namespace kstd::platform;
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::FileMapping mapping("./test/test_file_3.bin", access, mm::MappingFlags::POPULATE);
+    ASSERT_NE(mapping.get_address(), nullptr);
+    ASSERT_GT(mapping.get_size(), 0);
+
+    const auto range = mm::MappingRange {0, mapping.get_size()};
+    ASSERT_TRUE(mapping.advise(range, mm::MappingAdvice::SEQUENTIAL));
+    ASSERT_TRUE(mapping.advise(range, mm::MappingAdvice::WILL_NEED));
+    ASSERT_TRUE(mapping.advise(range, mm::MappingAdvice::POPULATE_READ));
+    ASSERT_FALSE(mapping.advise({0, mapping.get_size() + 1}, mm::MappingAdvice::NORMAL));
+}
+
+TEST(kstd_platform_FileMapping, test_sync_dirty_ranges) {
+    using namespace kstd::platform;
+
+    {
+        file::File file("./test/test_file_4.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(get_page_size() * 4));
+    }
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::FileMapping mapping("./test/test_file_4.bin", access);
+    ASSERT_EQ(mapping.get_size(), get_page_size() * 4);
+
+    auto* data = static_cast<kstd::u8*>(mapping.get_address());
+    data[0] = 0xAA;
+    data[get_page_size() * 2 + 16] = 0xBB;
+
+    ASSERT_TRUE(mapping.mark_dirty({0, 1}));
+    ASSERT_TRUE(mapping.mark_dirty({get_page_size() * 2 + 16, 1}));
+    ASSERT_FALSE(mapping.mark_dirty({0, get_page_size() * 5}));
+    ASSERT_TRUE(mapping.flush(mm::SyncFlags::ASYNC));
+    ASSERT_TRUE(mapping.flush());
+    ASSERT_TRUE(mapping.sync({get_page_size(), get_page_size()}, mm::SyncFlags::INVALIDATE));
+    ASSERT_TRUE(mapping.sync());
+}
+
+TEST(kstd_platform_FileMapping, test_write_tracking) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+
+    {
+        file::File file("./test/test_file_5.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(page_size * 4));
+    }
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::FileMapping mapping("./test/test_file_5.bin", access);
+    ASSERT_TRUE(mapping.set_write_tracking(true));
+    ASSERT_TRUE(mapping.is_write_tracking());
+    ASSERT_EQ(mapping.get_dirty_pages().get_dirty_page_count(), 0);
+
+    auto* data = static_cast<kstd::u8*>(mapping.get_address());
+    data[page_size + 8] = 0xAA;
+    data[page_size * 3] = 0xBB;
+
+    auto& dirty_pages = mapping.get_dirty_pages();
+    ASSERT_FALSE(dirty_pages.is_dirty(0));
+    ASSERT_TRUE(dirty_pages.is_dirty(1));
+    ASSERT_FALSE(dirty_pages.is_dirty(2));
+    ASSERT_TRUE(dirty_pages.is_dirty(3));
+    ASSERT_EQ(dirty_pages.get_ranges().size(), 2);
+    ASSERT_TRUE(mapping.flush());
+    ASSERT_EQ(dirty_pages.get_dirty_page_count(), 0);
+
+    data[page_size + 16] = 0xCC;// Flushed pages are write-protected again
+    ASSERT_TRUE(dirty_pages.is_dirty(1));
+    ASSERT_TRUE(mapping.set_write_tracking(false));
+    data[0] = 0xDD;
+    ASSERT_FALSE(dirty_pages.is_dirty(0));
+}
+
+TEST(kstd_platform_FileMapping, test_typed_views) {
+    using namespace kstd::platform;
+
+    {
+        file::File file("./test/test_file_6.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(sizeof(kstd::u32) * 64));
+    }
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::FileMapping mapping("./test/test_file_6.bin", access);
+
+    auto array_result = mapping.as_array<kstd::u32>();
+    ASSERT_TRUE(array_result);
+    ASSERT_EQ(array_result->get_size(), 64);
+
+    for(kstd::u32 index = 0; index < 64; ++index) {
+        (*array_result)[index] = index;
+    }
+
+    auto value_result = mapping.view_at<const kstd::u32>(sizeof(kstd::u32) * 10);
+    ASSERT_TRUE(value_result);
+    ASSERT_EQ(**value_result, 10);
+
+    ASSERT_FALSE(mapping.view_at<kstd::u32>(1));                     // Misaligned
+    ASSERT_FALSE(mapping.view_at<kstd::u32>(sizeof(kstd::u32) * 64));// Out of bounds
+    ASSERT_FALSE(mapping.as_array<kstd::u64>(0, 33));
+
+#ifdef __cpp_lib_span
+    auto span_result = mapping.as_span<const kstd::u32>(sizeof(kstd::u32) * 60);
+    ASSERT_TRUE(span_result);
+    ASSERT_EQ(span_result->size(), 4);
+    ASSERT_EQ((*span_result)[3], 63);
+#endif
+}
+
+TEST(kstd_platform_FileMapping, test_private_mapping) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+
+    {
+        file::File file("./test/test_file_7.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(page_size * 4));
+    }
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::FileMapping shared_mapping("./test/test_file_7.bin", access);
+    mm::FileMapping private_mapping("./test/test_file_7.bin", access, mm::MappingFlags::PRIVATE);
+
+    auto* shared_data = static_cast<kstd::u8*>(shared_mapping.get_address());
+    auto* private_data = static_cast<kstd::u8*>(private_mapping.get_address());
+    shared_data[0] = 0xAA;
+    ASSERT_EQ(private_data[0], 0xAA);// Untouched pages still see the file
+
+    private_data[page_size] = 0xBB;
+    ASSERT_EQ(private_data[page_size], 0xBB);
+    ASSERT_EQ(shared_data[page_size], 0x00);// Copy on write never reaches the file
+
+    auto private_pages = private_mapping.get_private_page_count();
+    ASSERT_TRUE(private_pages);
+    ASSERT_EQ(*private_pages, 1);
+    ASSERT_TRUE(private_mapping.sync());
+    ASSERT_EQ(shared_data[page_size], 0x00);
+}
+
+TEST(kstd_platform_FileMapping, test_private_mapping_of_empty_file) {
+    using namespace kstd::platform;
+
+    std::filesystem::remove("./test/test_file_13.bin");
+    { file::File file("./test/test_file_13.bin", file::FileMode::READ_WRITE); }
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    ASSERT_THROW(mm::FileMapping("./test/test_file_13.bin", access, mm::MappingFlags::PRIVATE), std::runtime_error);
+    ASSERT_EQ(std::filesystem::file_size("./test/test_file_13.bin"), 0);// The file is left untouched
+}
+
+TEST(kstd_platform_FileMapping, test_writable_and_executable) {
+    using namespace kstd::platform;
+
+    std::filesystem::remove("./test/test_file_14.bin");
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE | mm::MappingAccess::EXECUTE;
+    ASSERT_THROW(mm::FileMapping("./test/test_file_14.bin", access), std::runtime_error);
+    ASSERT_FALSE(std::filesystem::exists("./test/test_file_14.bin"));
+}
+
+TEST(kstd_platform_FileMapping, test_residency) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+
+    {
+        file::File file("./test/test_file_9.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(page_size * 8));
+    }
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::FileMapping mapping("./test/test_file_9.bin", access);
+    auto* data = static_cast<kstd::u8*>(mapping.get_address());
+    data[page_size * 2] = 0xAA;
+
+    auto residency = mapping.get_residency();
+    ASSERT_TRUE(residency);
+    ASSERT_EQ(residency->get_page_count(), 8);
+    ASSERT_TRUE(residency->is_resident(2));
+
+    auto partial_residency = mapping.get_residency({page_size * 2 + 1, 1});
+    ASSERT_TRUE(partial_residency);
+    ASSERT_EQ(partial_residency->get_page_count(), 1);
+    ASSERT_EQ(partial_residency->get_resident_page_count(), 1);
+
+    ASSERT_FALSE(mapping.get_residency({page_size * 8, 1}));
+}
+
+TEST(kstd_platform_FileMapping, test_resize) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+
+    {
+        file::File file("./test/test_file_11.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(page_size));
+    }
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::FileMapping mapping("./test/test_file_11.bin", access);
+    static_cast<kstd::u8*>(mapping.get_address())[0] = 0xAA;
+    ASSERT_TRUE(mapping.mark_dirty({0, 1}));
+    ASSERT_TRUE(mapping.set_write_tracking(true));
+
+    ASSERT_TRUE(mapping.resize(page_size * 16));
+    ASSERT_EQ(mapping.get_size(), page_size * 16);
+    ASSERT_EQ(mapping.get_file().get_size().get_or(0), page_size * 16);
+    ASSERT_TRUE(mapping.is_write_tracking());
+    ASSERT_TRUE(mapping.get_dirty_pages().is_dirty(0));
+
+    auto* data = static_cast<kstd::u8*>(mapping.get_address());
+    ASSERT_EQ(data[0], 0xAA);
+    data[page_size * 15] = 0xBB;
+    ASSERT_TRUE(mapping.get_dirty_pages().is_dirty(15));
+}
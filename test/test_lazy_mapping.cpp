@@ -0,0 +1,102 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+
+#include <csignal>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <kstd/platform/lazy_mapping.hpp>
+#include <kstd/platform/platform.hpp>
+#include <kstd/safe_alloc.hpp>
+
+TEST(kstd_platform_LazyMapping, test_provide_pages) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+    auto provider = [](kstd::usize offset, void* page, kstd::usize size) -> kstd::Result<mm::PageContent> {
+        if(offset == 0) {
+            return mm::PageContent::ZERO;
+        }
+
+        std::memset(page, static_cast<int>(offset / size), size);
+        return mm::PageContent::DATA;
+    };
+
+    auto mapping = kstd::try_construct<mm::LazyMapping>(8 * page_size, provider);
+
+    if(!mapping) {
+        GTEST_SKIP() << "userfaultfd is not available";
+    }
+
+    ASSERT_EQ(mapping->get_type(), mm::MappingType::LAZY);
+    ASSERT_EQ(mapping->get_residency()->get_resident_page_count(), 0);
+
+    const auto* data = static_cast<const kstd::u8*>(mapping->get_address());
+    ASSERT_EQ(data[0], 0);
+    ASSERT_EQ(data[page_size + 1], 1);
+    ASSERT_EQ(data[7 * page_size + 100], 7);
+
+    auto statistics = mapping->get_statistics();
+    ASSERT_EQ(statistics.fault_count, 3);
+    ASSERT_EQ(statistics.zero_page_count, 1);
+    ASSERT_EQ(statistics.failed_fault_count, 0);
+    ASSERT_GE(statistics.max_latency, statistics.get_average_latency());
+
+    // Dropped pages are provided again on their next access
+    static_cast<kstd::u8*>(mapping->get_address())[page_size] = 42;
+    ASSERT_TRUE(mapping->advise({page_size, page_size}, mm::MappingAdvice::DONT_NEED));
+    ASSERT_EQ(data[page_size], 1);
+    ASSERT_EQ(mapping->get_statistics().fault_count, 4);
+
+    mm::LazyMapping moved {std::move(*mapping)};
+    ASSERT_EQ(static_cast<const kstd::u8*>(moved.get_address())[3 * page_size], 3);
+    ASSERT_FALSE(moved.resize(page_size));
+}
+
+// Exits with 0 if touching a page which can't be provided raises SIGBUS instead of mapping zeroes
+[[noreturn]] static auto touch_failing_page() -> void {
+    using namespace kstd::platform;
+
+    if(std::signal(SIGBUS, [](int) { std::_Exit(0); }) == SIG_ERR) {
+        std::_Exit(2);
+    }
+
+    auto provider = [](kstd::usize, void*, kstd::usize) -> kstd::Result<mm::PageContent> {
+        return kstd::Error {std::string("Could not decompress block")};
+    };
+
+    mm::LazyMapping mapping {get_page_size(), provider};
+    static_cast<void>(*static_cast<volatile const kstd::u8*>(mapping.get_address()));
+    std::_Exit(1);
+}
+
+TEST(kstd_platform_LazyMapping, test_provider_failure) {
+    using namespace kstd::platform;
+
+    if(!kstd::try_construct<mm::LazyMapping>(get_page_size(), [](kstd::usize, void*, kstd::usize) {
+           return kstd::Result<mm::PageContent> {mm::PageContent::ZERO};
+       })) {
+        GTEST_SKIP() << "userfaultfd is not available";
+    }
+
+    ASSERT_EXIT(touch_failing_page(), ::testing::ExitedWithCode(0), "");
+}
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,169 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <kstd/platform/log_segment.hpp>
+#include <thread>
+#include <vector>
+
+TEST(kstd_platform_LogSegment, test_append_read) {
+    using namespace kstd::platform;
+
+    std::filesystem::remove("./test/test_log_segment.bin");
+    mm::LogSegment segment {"./test/test_log_segment.bin", 48};
+    ASSERT_EQ(segment.get_capacity(), 48);
+
+    const char message[] = "Hello, World!";// NOLINT
+    const auto region = segment.try_append(message, sizeof(message));
+    ASSERT_TRUE(region.is_valid());
+    ASSERT_EQ(region.position, 0);
+
+    // A reserved record stays invisible to readers until it is committed
+    auto pending = segment.try_reserve(sizeof(kstd::u64));
+    ASSERT_TRUE(pending.is_valid());
+    ASSERT_FALSE(segment.read(24).is_valid());
+    ASSERT_FALSE(segment.is_end(24));
+    std::memset(pending.data, 0xAB, pending.size);
+    segment.commit(pending);
+
+    const auto record = segment.read(0);
+    ASSERT_TRUE(record.is_valid());
+    ASSERT_EQ(record.size, sizeof(message));
+    ASSERT_STREQ(reinterpret_cast<const char*>(record.data), message);// NOLINT
+    ASSERT_EQ(segment.read(record.next_offset).size, sizeof(kstd::u64));
+
+    // The next record doesn't fit anymore, so the segment gets sealed
+    ASSERT_FALSE(segment.try_append(message, sizeof(message)).is_valid());
+    ASSERT_TRUE(segment.is_full());
+    ASSERT_TRUE(segment.is_end(40));
+}
+
+TEST(kstd_platform_LogSegment, test_rollover) {
+    using namespace kstd::platform;
+
+    constexpr kstd::usize thread_count = 4;
+    constexpr kstd::u64 records_per_thread = 10000;
+
+    std::filesystem::remove_all("./test/test_log");
+
+    {
+        mm::MappedLog log {"./test/test_log", 4096};
+        std::vector<std::thread> writers {};
+
+        for(kstd::usize thread = 0; thread < thread_count; ++thread) {
+            writers.emplace_back([&log, thread] {
+                for(kstd::u64 index = 0; index < records_per_thread; ++index) {
+                    const auto value = thread * records_per_thread + index;
+                    ASSERT_TRUE(log.append(&value, sizeof(value)));
+                }
+            });
+        }
+
+        for(auto& writer : writers) {
+            writer.join();
+        }
+
+        ASSERT_GT(log.get_current_segment(), 0);
+        ASSERT_TRUE(log.sync());
+    }
+
+    mm::MappedLogReader reader {"./test/test_log"};
+    std::vector<bool> seen(thread_count * records_per_thread, false);
+    kstd::usize count = 0;
+
+    for(auto record = reader.read(); record.is_valid(); record = reader.read()) {
+        ASSERT_EQ(record.size, sizeof(kstd::u64));
+        kstd::u64 value = 0;
+        std::memcpy(&value, record.data, sizeof(value));
+        ASSERT_FALSE(seen[value]);
+        seen[value] = true;
+        ++count;
+    }
+
+    ASSERT_EQ(count, thread_count * records_per_thread);
+    ASSERT_FALSE(mm::MappedLog("./test/test_log", 4096).append(nullptr, 8192));
+}
+
+TEST(kstd_platform_LogSegment, test_rollover_after_crash) {
+    using namespace kstd::platform;
+
+    std::filesystem::remove_all("./test/test_crashed_log");
+    const auto temporary_path = mm::get_log_segment_path("./test/test_crashed_log", 1).string() + ".tmp";
+    const auto plant_temporary_segment = [&temporary_path] {
+        std::ofstream {temporary_path} << "truncated";
+    };
+
+    static_cast<void>(mm::MappedLog {"./test/test_crashed_log", 4096});
+    plant_temporary_segment();
+
+    // Opening the log removes what a crashed rollover left behind
+    {
+        mm::MappedLog log {"./test/test_crashed_log", 4096};
+        ASSERT_FALSE(std::filesystem::exists(temporary_path));
+    }
+
+    // Rolling over replaces a leftover which appeared while the log was open
+    mm::MappedLog log {"./test/test_crashed_log", 4096};
+    plant_temporary_segment();
+    const kstd::u64 value = 0;
+
+    while(log.get_current_segment() == 0) {
+        ASSERT_TRUE(log.append(&value, sizeof(value)));
+    }
+
+    ASSERT_TRUE(log.append(&value, sizeof(value)));
+    ASSERT_FALSE(std::filesystem::exists(temporary_path));
+}
+
+TEST(kstd_platform_LogSegment, test_recover_uncommitted_records) {
+    using namespace kstd::platform;
+
+    std::filesystem::remove_all("./test/test_abandoned_log");
+    std::filesystem::create_directories("./test/test_abandoned_log");
+    mm::LogSegment segment {mm::get_log_segment_path("./test/test_abandoned_log", 0), 4096};
+    const kstd::u64 values[] = {1, 2, 3};// NOLINT
+
+    // A writer which crashed after reserving, and one which crashed before its reservation got a size
+    ASSERT_TRUE(segment.try_reserve(sizeof(kstd::u64)).is_valid());
+    ASSERT_TRUE(segment.try_append(&values[0], sizeof(kstd::u64)).is_valid());
+    const auto region = segment.try_reserve(sizeof(kstd::u64));
+    ASSERT_TRUE(region.is_valid());
+    std::memset(region.data - sizeof(kstd::u64), 0, sizeof(kstd::u64));// NOLINT
+    ASSERT_TRUE(segment.try_append(&values[1], sizeof(kstd::u64)).is_valid());
+
+    mm::MappedLogReader reader {"./test/test_abandoned_log"};
+    ASSERT_FALSE(reader.read().is_valid());
+
+    mm::MappedLog log {"./test/test_abandoned_log", 4096};
+    ASSERT_TRUE(segment.is_full());
+    const auto position = log.append(&values[2], sizeof(kstd::u64));
+    ASSERT_TRUE(position);
+    ASSERT_EQ(position->segment, 1);
+
+    // The record behind the sealed reservation is lost, everything else is read in order
+    for(const auto value : {values[0], values[2]}) {
+        const auto record = reader.read();
+        ASSERT_TRUE(record.is_valid());
+        ASSERT_EQ(std::memcmp(record.data, &value, sizeof(value)), 0);
+    }
+
+    ASSERT_FALSE(reader.read().is_valid());
+}
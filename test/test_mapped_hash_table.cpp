@@ -0,0 +1,98 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <kstd/platform/mapped_hash_table.hpp>
+
+TEST(kstd_platform_MappedHashTable, test_insert_find_erase) {
+    using namespace kstd::platform;
+    using Table = mm::MappedHashTable<kstd::u64, kstd::u32>;
+
+    std::filesystem::remove("./test/test_hash_table.bin");
+    Table table {"./test/test_hash_table.bin"};
+    ASSERT_TRUE(table.is_empty());
+    ASSERT_EQ(table.get_capacity(), Table::min_capacity);
+
+    for(kstd::u64 key = 0; key < 10000; ++key) {
+        ASSERT_TRUE(table.insert(key * 7, static_cast<kstd::u32>(key)));
+    }
+
+    ASSERT_EQ(table.get_size(), 10000);
+    ASSERT_LE(table.get_load_factor(), 0.75);
+    ASSERT_EQ(*table.find(4242 * 7), 4242);
+    ASSERT_EQ(table.find(4242 * 7 + 1), nullptr);
+
+    ASSERT_TRUE(table.insert(7, 1234));// Replaces the existing value
+    ASSERT_EQ(table.get_size(), 10000);
+    ASSERT_EQ(*table.find(7), 1234);
+
+    // Erase every other key, which shifts back entries that probed past them
+    for(kstd::u64 key = 0; key < 10000; key += 2) {
+        ASSERT_TRUE(table.erase(key * 7));
+    }
+
+    ASSERT_FALSE(table.erase(0));
+    ASSERT_EQ(table.get_size(), 5000);
+
+    for(kstd::u64 key = 0; key < 10000; ++key) {
+        ASSERT_EQ(table.contains(key * 7), (key & 1U) != 0);
+    }
+
+    table.clear();
+    ASSERT_TRUE(table.is_empty());
+    ASSERT_FALSE(table.contains(7));
+}
+
+TEST(kstd_platform_MappedHashTable, test_persistent) {
+    using namespace kstd::platform;
+
+    std::filesystem::remove("./test/test_hash_table.bin");
+
+    {
+        mm::MappedHashTable<kstd::u64, kstd::u64> table {"./test/test_hash_table.bin", 1024};
+        ASSERT_EQ(table.get_capacity(), 1024);
+
+        for(kstd::u64 key = 1; key <= 5000; ++key) {
+            ASSERT_TRUE(table.insert(key, key * key));
+        }
+
+        ASSERT_TRUE(table.sync());
+    }
+
+    // Pretend a resize crashed midway, its leftover must not affect the table
+    {
+        std::filesystem::copy_file("./test/test_hash_table.bin", "./test/test_hash_table.bin.rehash");
+        std::filesystem::resize_file("./test/test_hash_table.bin.rehash", 100);
+    }
+
+    {
+        mm::MappedHashTable<kstd::u64, kstd::u64> table {"./test/test_hash_table.bin"};
+        ASSERT_FALSE(std::filesystem::exists("./test/test_hash_table.bin.rehash"));
+        ASSERT_EQ(table.get_size(), 5000);
+        ASSERT_EQ(*table.find(4000), 16000000);
+
+        kstd::u64 sum = 0;
+        table.for_each([&sum](const kstd::u64& key, const kstd::u64& value) noexcept { sum += value - key * key; });
+        ASSERT_EQ(sum, 0);
+    }
+
+    using MismatchingTable = mm::MappedHashTable<kstd::u64, kstd::u32>;
+    ASSERT_THROW(MismatchingTable {"./test/test_hash_table.bin"}, std::runtime_error);
+}
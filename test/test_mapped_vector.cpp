@@ -0,0 +1,88 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <kstd/platform/mapped_vector.hpp>
+
+struct Record final {
+    kstd::u64 key;
+    kstd::u32 value;
+    kstd::u32 flags;
+};
+
+TEST(kstd_platform_MappedVector, test_anonymous) {
+    using namespace kstd::platform;
+
+    mm::MappedVector<Record> records {1U << 24U};
+    ASSERT_FALSE(records.is_persistent());
+    ASSERT_TRUE(records.is_empty());
+    auto* data = records.get_data();
+
+    for(kstd::u64 index = 0; index < 100000; ++index) {
+        ASSERT_TRUE(records.push_back({index, static_cast<kstd::u32>(index * 2), 0}));
+    }
+
+    ASSERT_EQ(records.get_data(), data);// Growing never moves anonymous vectors
+    ASSERT_EQ(records.get_size(), 100000);
+    ASSERT_EQ(records[4242].value, 8484);
+
+    records.pop_back();
+    ASSERT_EQ(records.get_size(), 99999);
+    ASSERT_TRUE(records.resize(100010));
+    ASSERT_EQ(records[100005].key, 0);// New elements are value-initialized
+
+    ASSERT_FALSE(records.reserve((1U << 24U) / sizeof(Record) + 1));
+}
+
+TEST(kstd_platform_MappedVector, test_persistent) {
+    using namespace kstd::platform;
+
+    std::filesystem::remove("./test/test_vector.bin");
+
+    {
+        mm::MappedVector<Record> records {"./test/test_vector.bin"};
+        ASSERT_TRUE(records.is_persistent());
+        ASSERT_TRUE(records.is_empty());
+
+        for(kstd::u64 index = 0; index < 50000; ++index) {
+            ASSERT_TRUE(records.emplace_back(Record {index, static_cast<kstd::u32>(index + 1), 1}));
+        }
+
+        ASSERT_GE(records.get_capacity(), 50000);
+        ASSERT_TRUE(records.sync());
+    }
+
+    {
+        mm::MappedVector<Record> records {"./test/test_vector.bin"};
+        ASSERT_EQ(records.get_size(), 50000);
+        ASSERT_EQ(records[49999].key, 49999);
+        ASSERT_EQ(records[123].value, 124);
+
+        kstd::u64 sum = 0;
+
+        for(const auto& record : records) {
+            sum += record.flags;
+        }
+
+        ASSERT_EQ(sum, 50000);
+    }
+
+    ASSERT_THROW(mm::MappedVector<kstd::u32> {"./test/test_vector.bin"}, std::runtime_error);
+}
@@ -0,0 +1,74 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/platform/mapping_registry.hpp>
+
+TEST(kstd_platform_MappingRegistry, test_shared_mappings) {
+    using namespace kstd::platform;
+
+    {
+        file::File file("./test/test_registry.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(get_page_size() * 2));
+    }
+
+    mm::MappingRegistry registry {};
+    auto first_result = registry.acquire("./test/test_registry.bin", mm::MappingAccess::READ);
+    ASSERT_TRUE(first_result);
+    auto second_result = registry.acquire("./test/test_registry.bin", mm::MappingAccess::READ);
+    ASSERT_TRUE(second_result);
+    ASSERT_EQ(first_result->get(), second_result->get());
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    auto writable_result = registry.acquire("./test/test_registry.bin", access);
+    ASSERT_TRUE(writable_result);
+    ASSERT_NE(first_result->get(), writable_result->get());
+
+    const auto statistics = registry.get_statistics();
+    ASSERT_EQ(statistics.size(), 1);
+    ASSERT_EQ(statistics[0].mapping_count, 2);
+    ASSERT_EQ(statistics[0].mapped_bytes, get_page_size() * 4);
+    ASSERT_EQ(registry.get_mapped_bytes(statistics[0].identity), get_page_size() * 4);
+
+    *first_result = nullptr;
+    *second_result = nullptr;
+    ASSERT_EQ(registry.get_total_mapped_bytes(), get_page_size() * 2);
+}
+
+TEST(kstd_platform_MappingRegistry, test_private_mappings) {
+    using namespace kstd::platform;
+
+    {
+        file::File file("./test/test_registry_private.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(get_page_size()));
+    }
+
+    mm::MappingRegistry registry {};
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    auto first_result = registry.acquire("./test/test_registry_private.bin", access, mm::MappingFlags::PRIVATE);
+    ASSERT_TRUE(first_result);
+    auto second_result = registry.acquire("./test/test_registry_private.bin", access, mm::MappingFlags::PRIVATE);
+    ASSERT_TRUE(second_result);
+    ASSERT_NE(first_result->get(), second_result->get());
+
+    // Copy on write stays with the mapping that wrote
+    static_cast<kstd::u8*>((*first_result)->get_address())[0] = 0xAA;
+    ASSERT_EQ(static_cast<kstd::u8*>((*second_result)->get_address())[0], 0x00);
+    ASSERT_EQ(registry.get_total_mapped_bytes(), 0);
+}
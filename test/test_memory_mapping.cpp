@@ -0,0 +1,83 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <kstd/platform/virtual_arena.hpp>
+
+#ifdef PLATFORM_LINUX
+#include <cstdlib>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+TEST(kstd_platform_MemoryMapping, test_advise_keeps_surrounding_bytes) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+    mm::VirtualArena arena {page_size * 4, page_size * 4};
+    auto* data = static_cast<kstd::u8*>(*arena.allocate(page_size * 4));
+    std::fill(data, data + page_size * 4, 0xAA);// NOLINT
+
+    // Only the second and third page lie entirely inside of the range
+    ASSERT_TRUE(arena.advise({page_size - 1, page_size * 2 + 2}, mm::MappingAdvice::DONT_NEED));
+    ASSERT_EQ(data[page_size - 1], 0xAA);
+    ASSERT_EQ(data[page_size], 0x00);
+    ASSERT_EQ(data[page_size * 3 - 1], 0x00);
+    ASSERT_EQ(data[page_size * 3], 0xAA);
+
+    ASSERT_TRUE(arena.advise({1, page_size}, mm::MappingAdvice::DONT_NEED));// No whole page, nothing is dropped
+    ASSERT_EQ(data[1], 0xAA);
+}
+
+#ifdef PLATFORM_LINUX
+
+// Exits with 0 if locking beyond a lowered limit is refused, which can't be undone in this process
+[[noreturn]] static auto lock_beyond_lowered_limit() -> void {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+
+    if(::geteuid() == 0 && ::setuid(65534) != 0) {// Root is exempt from the lock limit
+        std::_Exit(2);
+    }
+
+    rlimit limit {};
+    ::getrlimit(RLIMIT_MEMLOCK, &limit);
+    limit.rlim_cur = std::min<rlim_t>(limit.rlim_max, page_size * 2);
+
+    if(::setrlimit(RLIMIT_MEMLOCK, &limit) != 0) {
+        std::_Exit(3);
+    }
+
+    mm::VirtualArena arena {page_size * 4, page_size * 4};
+
+    if(!arena.allocate(page_size * 4) || !arena.lock({0, page_size})) {
+        std::_Exit(4);
+    }
+
+    const auto is_refused = !arena.lock({0, page_size * 4}) && !mm::lock_process_memory();
+    std::_Exit(is_refused ? 0 : 1);
+}
+
+TEST(kstd_platform_MemoryMapping, test_lock_limit) {
+    ASSERT_EXIT(lock_beyond_lowered_limit(), ::testing::ExitedWithCode(0), "");
+}
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,58 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/platform/file.hpp>
+#include <kstd/platform/file_mapping.hpp>
+#include <kstd/platform/numa.hpp>
+
+TEST(kstd_platform_Numa, test_thread_policy) {
+    using namespace kstd::platform;
+
+    ASSERT_GE(get_numa_node_count(), 1);
+    ASSERT_TRUE(set_thread_numa_policy(NumaPolicy::PREFERRED, {0}));
+    ASSERT_TRUE(set_thread_numa_policy(NumaPolicy::DEFAULT));
+    ASSERT_FALSE(set_thread_numa_policy(NumaPolicy::BIND));
+    ASSERT_FALSE(set_thread_numa_policy(NumaPolicy::LOCAL, {0}));
+    ASSERT_FALSE(set_thread_numa_policy(NumaPolicy::PREFERRED, {static_cast<kstd::u32>(get_numa_node_count())}));
+}
+
+TEST(kstd_platform_Numa, test_mapping_policy) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+
+    {
+        file::File file("./test/test_file_10.bin", file::FileMode::READ_WRITE);
+        ASSERT_TRUE(file.resize(page_size * 4));
+    }
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::FileMapping mapping("./test/test_file_10.bin", access);
+    ASSERT_TRUE(mapping.set_numa_policy({0, mapping.get_size()}, NumaPolicy::PREFERRED, {0}));
+    ASSERT_FALSE(mapping.set_numa_policy({0, mapping.get_size() + 1}, NumaPolicy::DEFAULT));
+
+    static_cast<kstd::u8*>(mapping.get_address())[page_size] = 0xAA;
+
+    auto nodes = mapping.get_numa_nodes({0, mapping.get_size()});
+    ASSERT_TRUE(nodes);
+    ASSERT_EQ(nodes->size(), 4);
+    ASSERT_GE((*nodes)[1], 0);
+    ASSERT_LT(static_cast<kstd::usize>((*nodes)[1]), get_numa_node_count());
+}
@@ -0,0 +1,101 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <kstd/platform/file_mapping.hpp>
+#include <kstd/platform/prefault.hpp>
+
+#ifdef PLATFORM_LINUX
+#include <cstdlib>
+#include <kstd/platform/virtual_arena.hpp>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+TEST(kstd_platform_Prefault, test_prefault) {
+    using namespace kstd::platform;
+
+    constexpr kstd::usize size = 16 * 1024 * 1024;
+
+    std::filesystem::remove("./test/test_file_12.bin");
+    mm::FileMapping mapping {"./test/test_file_12.bin", mm::MappingAccess::READ | mm::MappingAccess::WRITE};
+    ASSERT_TRUE(mapping.resize(size));
+
+    kstd::usize report_count = 0;
+    mm::PrefaultOptions options {};
+    options.thread_count = 4;
+    options.chunk_size = 1024 * 1024;
+    options.progress_interval = std::chrono::milliseconds {1};
+    options.on_progress = [&report_count](const mm::PrefaultProgress& progress) {
+        ASSERT_LE(progress.done_size, progress.total_size);
+        ++report_count;
+    };
+
+    auto progress = mm::prefault(mapping, options);
+    ASSERT_TRUE(progress);
+    ASSERT_EQ(progress->done_size, size);
+    ASSERT_EQ(progress->get_ratio(), 1.0);
+    ASSERT_GT(report_count, 0);
+
+    // 4 MiB at 16 MiB/s has to take at least the 3 chunks after the first one
+    options.max_bandwidth = size;
+    progress = mm::prefault(mapping, mm::MappingRange {0, 4 * 1024 * 1024}, options);
+    ASSERT_TRUE(progress);
+    ASSERT_GE(progress->elapsed, std::chrono::milliseconds {180});
+    ASSERT_LE(progress->get_throughput(), static_cast<kstd::f64>(size) * 1.5);
+
+    ASSERT_FALSE(mm::prefault(mapping, mm::MappingRange {size - 1, 2}));
+}
+
+#ifdef PLATFORM_LINUX
+
+// Exits with 0 if prefaulting fails cleanly when only some of its threads can be started
+[[noreturn]] static auto prefault_without_threads() -> void {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+    mm::VirtualArena arena {page_size * 64, page_size * 64};
+
+    if(!arena.allocate(page_size * 64)) {
+        std::_Exit(2);
+    }
+
+    // Root may always start threads, and the limit counts every process of the user
+    if(::geteuid() == 0 && ::setuid(65534) != 0) {
+        std::_Exit(3);
+    }
+
+    rlimit limit {2, 2};
+
+    if(::setrlimit(RLIMIT_NPROC, &limit) != 0) {
+        std::_Exit(4);
+    }
+
+    mm::PrefaultOptions options {};
+    options.thread_count = 8;
+    options.chunk_size = page_size;
+    std::_Exit(mm::prefault(arena, options) ? 1 : 0);
+}
+
+TEST(kstd_platform_Prefault, test_thread_start_failure) {
+    ASSERT_EXIT(prefault_without_threads(), ::testing::ExitedWithCode(0), "");
+}
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,103 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <kstd/platform/ring_mapping.hpp>
+#include <thread>
+#include <vector>
+
+TEST(kstd_platform_RingMapping, test_wrap_around) {
+    using namespace kstd::platform;
+
+    mm::RingMapping ring(1);
+    const auto size = ring.get_size();
+    ASSERT_GE(size, get_page_size());
+
+    auto* data = static_cast<kstd::u8*>(ring.get_address());
+    data[0] = 0xAA;
+    ASSERT_EQ(data[size], 0xAA);// Both halves share the same memory
+
+    // Move the cursors close to the end, so the next region wraps around
+    auto region = ring.try_reserve(size - 8);
+    ASSERT_TRUE(region.is_valid());
+    ring.commit(region);
+    ring.release(ring.peek().size);
+
+    region = ring.try_reserve(16);
+    ASSERT_TRUE(region.is_valid());
+    std::memset(region.data, 0xBB, region.size);
+    ring.commit(region);
+    ASSERT_EQ(data[0], 0xBB);
+    ASSERT_EQ(data[7], 0xBB);
+
+    const auto readable = ring.peek();
+    ASSERT_EQ(readable.size, 16);
+    ASSERT_EQ(readable.data[15], 0xBB);
+    ring.release(readable.size);
+    ASSERT_FALSE(ring.try_reserve(size + 1).is_valid());
+}
+
+TEST(kstd_platform_RingMapping, test_multiple_producers) {
+    using namespace kstd::platform;
+
+    constexpr kstd::usize producer_count = 4;
+    constexpr kstd::u64 values_per_producer = 10000;
+    mm::RingMapping ring(get_page_size(), mm::RingMode::MULTI_PRODUCER);
+    std::vector<std::thread> producers {};
+
+    for(kstd::usize producer = 0; producer < producer_count; ++producer) {
+        producers.emplace_back([&ring] {
+            for(kstd::u64 value = 1; value <= values_per_producer; ++value) {
+                auto region = ring.try_reserve(sizeof(kstd::u64));
+
+                while(!region.is_valid()) {
+                    std::this_thread::yield();
+                    region = ring.try_reserve(sizeof(kstd::u64));
+                }
+
+                std::memcpy(region.data, &value, sizeof(kstd::u64));
+                ring.commit(region);
+            }
+        });
+    }
+
+    kstd::u64 sum = 0;
+    kstd::usize received = 0;
+
+    while(received < producer_count * values_per_producer) {
+        const auto region = ring.peek();
+        const auto count = region.size / sizeof(kstd::u64);
+
+        for(kstd::usize index = 0; index < count; ++index) {
+            kstd::u64 value = 0;
+            std::memcpy(&value, region.data + index * sizeof(kstd::u64), sizeof(kstd::u64));
+            sum += value;
+        }
+
+        ring.release(count * sizeof(kstd::u64));
+        received += count;
+    }
+
+    for(auto& producer : producers) {
+        producer.join();
+    }
+
+    ASSERT_EQ(sum, producer_count * (values_per_producer * (values_per_producer + 1) / 2));
+}
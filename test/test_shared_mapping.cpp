@@ -0,0 +1,133 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <cstring>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <kstd/platform/process.hpp>
+#include <kstd/platform/shared_queue.hpp>
+#include <thread>
+
+#ifdef PLATFORM_LINUX
+#include <chrono>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+TEST(kstd_platform_SharedMapping, test_create_open) {
+    using namespace kstd::platform;
+
+    const auto name = fmt::format("kstd-test-shm-{}", Process::get_current()->get_pid());
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::SharedMapping creator(name, access, mm::SharedMode::CREATE, 4096);
+    ASSERT_TRUE(creator.is_owner());
+    ASSERT_EQ(creator.get_size(), 4096);
+
+    mm::SharedMapping peer(name, mm::MappingAccess::READ, mm::SharedMode::OPEN);
+    ASSERT_FALSE(peer.is_owner());
+    ASSERT_GE(peer.get_size(), 4096);
+
+    static_cast<kstd::u8*>(creator.get_address())[42] = 0xAA;
+    ASSERT_EQ(static_cast<kstd::u8*>(peer.get_address())[42], 0xAA);
+    ASSERT_THROW(mm::SharedMapping(name, access, mm::SharedMode::CREATE, 4096), std::runtime_error);
+    ASSERT_THROW(mm::SharedMapping(name, access, mm::SharedMode::OPEN, 1 << 24), std::runtime_error);
+}
+
+TEST(kstd_platform_SharedMapping, test_queue) {
+    using namespace kstd::platform;
+
+    constexpr kstd::u32 message_count = 100000;
+    const auto name = fmt::format("kstd-test-queue-{}", Process::get_current()->get_pid());
+    mm::SharedQueue producer_queue(name, mm::SharedMode::CREATE, 1000);
+    mm::SharedQueue consumer_queue(name, mm::SharedMode::OPEN);
+    ASSERT_EQ(consumer_queue.get_capacity(), producer_queue.get_capacity());
+
+    std::thread producer([&producer_queue] {
+        for(kstd::u32 index = 0; index < message_count; ++index) {
+            const auto size = sizeof(kstd::u32) + (index % 13);
+            auto region = producer_queue.try_reserve(size);
+
+            while(!region.is_valid()) {
+                std::this_thread::yield();
+                region = producer_queue.try_reserve(size);
+            }
+
+            std::memcpy(region.data, &index, sizeof(kstd::u32));
+            producer_queue.commit(region);
+        }
+    });
+
+    for(kstd::u32 index = 0; index < message_count; ++index) {
+        auto region = consumer_queue.peek();
+
+        while(!region.is_valid()) {
+            std::this_thread::yield();
+            region = consumer_queue.peek();
+        }
+
+        kstd::u32 value = 0;
+        std::memcpy(&value, region.data, sizeof(kstd::u32));
+        ASSERT_EQ(region.size, sizeof(kstd::u32) + (index % 13));
+        ASSERT_EQ(value, index);
+        consumer_queue.release(region);
+    }
+
+    producer.join();
+}
+
+TEST(kstd_platform_SharedMapping, test_queue_with_invalid_capacity) {
+    using namespace kstd::platform;
+
+    const auto name = fmt::format("kstd-test-bad-queue-{}", Process::get_current()->get_pid());
+    mm::SharedQueue queue(name, mm::SharedMode::CREATE, 1000);
+    mm::SharedMapping peer(name, mm::MappingAccess::READ | mm::MappingAccess::WRITE, mm::SharedMode::OPEN);
+
+    // Another process may write anything into the header
+    static_cast<mm::SharedQueueHeader*>(peer.get_address())->capacity = 1 << 30;
+    ASSERT_THROW(mm::SharedQueue(name, mm::SharedMode::OPEN), std::runtime_error);
+}
+
+#ifdef PLATFORM_LINUX
+
+TEST(kstd_platform_SharedMapping, test_open_before_sized) {
+    using namespace kstd::platform;
+
+    const auto name = fmt::format("/kstd-test-unsized-{}", Process::get_current()->get_pid());
+    const auto handle = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    ASSERT_NE(handle, -1);
+
+    // The creator sizes the region a moment after creating it
+    std::thread creator([handle] {
+        std::this_thread::sleep_for(std::chrono::milliseconds {20});
+        static_cast<void>(::ftruncate(handle, 4096));
+    });
+
+    const auto access = mm::MappingAccess::READ | mm::MappingAccess::WRITE;
+    mm::SharedMapping peer(name, access, mm::SharedMode::OPEN_OR_CREATE, 4096);
+    creator.join();
+    ASSERT_FALSE(peer.is_owner());
+    ASSERT_EQ(peer.get_size(), 4096);
+
+    ::close(handle);
+    ASSERT_TRUE(mm::SharedMapping::unlink(name));
+}
+
+#endif// PLATFORM_LINUX
@@ -0,0 +1,148 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/platform/slab_allocator.hpp>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+struct Connection final {
+    kstd::u64 id;
+    kstd::u8 buffer[120];// NOLINT
+};
+
+TEST(kstd_platform_SlabAllocator, test_allocate_and_reuse) {
+    using namespace kstd::platform;
+
+    mm::SlabAllocator allocator {sizeof(Connection), alignof(Connection), mm::SlabFlags::NONE, 16U << 20U};
+    std::vector<Connection*> connections {};
+    std::unordered_set<Connection*> addresses {};
+
+    for(kstd::u64 index = 0; index < 2000; ++index) {
+        auto connection = allocator.create<Connection>(Connection {index, {}});
+        ASSERT_TRUE(connection);
+        ASSERT_EQ(reinterpret_cast<kstd::usize>(*connection) % alignof(Connection), 0);// NOLINT
+        ASSERT_TRUE(addresses.insert(*connection).second);
+        connections.push_back(*connection);
+    }
+
+    for(kstd::u64 index = 0; index < connections.size(); ++index) {
+        ASSERT_EQ(connections[index]->id, index);
+    }
+
+    auto* last = connections.back();
+    allocator.destroy(last);
+    connections.pop_back();
+    auto reused = allocator.create<Connection>();
+    ASSERT_TRUE(reused);
+    ASSERT_EQ(*reused, last);
+    connections.push_back(*reused);
+
+    auto statistics = allocator.get_statistics();
+    ASSERT_EQ(statistics.allocation_count, 2001);
+    ASSERT_EQ(statistics.free_count, 1);
+    ASSERT_EQ(statistics.get_live_object_count(), 2000);
+    ASSERT_GE(statistics.object_capacity, 2000);
+    ASSERT_LT(statistics.get_fragmentation(), 1.0);
+
+    for(auto* connection : connections) {
+        allocator.destroy(connection);
+    }
+
+    ASSERT_EQ(allocator.get_statistics().get_live_object_count(), 0);
+    ASSERT_EQ(allocator.get_statistics().get_fragmentation(), 1.0);
+}
+
+TEST(kstd_platform_SlabAllocator, test_remote_free) {
+    using namespace kstd::platform;
+
+    mm::SlabAllocator allocator {64, 16, mm::SlabFlags::GUARD_PAGES, 16U << 20U};
+    std::vector<void*> objects {};
+
+    for(kstd::usize index = 0; index < 1000; ++index) {
+        auto object = allocator.allocate();
+        ASSERT_TRUE(object);
+        objects.push_back(*object);
+    }
+
+    std::thread producer {[&allocator, &objects] {
+        for(auto* object : objects) {
+            allocator.deallocate(object);
+        }
+    }};
+    producer.join();
+
+    auto statistics = allocator.get_statistics();
+    ASSERT_EQ(statistics.remote_free_count, 1000);
+    ASSERT_EQ(statistics.get_live_object_count(), 0);
+
+    // Remotely freed objects flow back to the heap of the allocating thread
+    auto object = allocator.allocate();
+    ASSERT_TRUE(object);
+    ASSERT_EQ(*object, objects.back());
+    ASSERT_EQ(allocator.get_statistics().slab_count, statistics.slab_count);
+}
+
+TEST(kstd_platform_SlabAllocator, test_orphaned_heaps) {
+    using namespace kstd::platform;
+
+    mm::SlabAllocator allocator {64, 16, mm::SlabFlags::NONE, 16U << 20U};
+    const auto objects_per_slab = allocator.get_objects_per_slab();
+    std::vector<void*> objects {};
+
+    auto first = allocator.allocate();
+    ASSERT_TRUE(first);
+
+    std::thread {[&allocator, &objects] {
+        for(kstd::usize index = 0; index < 100; ++index) {
+            objects.push_back(allocator.allocate().get_or_throw());
+        }
+    }}.join();
+
+    ASSERT_EQ(allocator.get_statistics().slab_count, 2);
+
+    // Frees into the heap of the exited thread, which is drained before carving another slab
+    for(auto* object : objects) {
+        allocator.deallocate(object);
+    }
+
+    for(kstd::usize index = 0; index < 2 * objects_per_slab - 1; ++index) {
+        ASSERT_TRUE(allocator.allocate());
+    }
+
+    ASSERT_EQ(allocator.get_statistics().slab_count, 2);
+    ASSERT_TRUE(allocator.allocate());
+    ASSERT_EQ(allocator.get_statistics().slab_count, 3);
+
+    // A new thread adopts the heap of an exited one instead of creating its own
+    std::thread {[&allocator] { allocator.deallocate(allocator.allocate().get_or_throw()); }}.join();
+    const auto slab_count = allocator.get_statistics().slab_count;
+    std::thread {[&allocator] { allocator.deallocate(allocator.allocate().get_or_throw()); }}.join();
+    ASSERT_EQ(allocator.get_statistics().slab_count, slab_count);
+    ASSERT_EQ(allocator.get_statistics().get_live_object_count(), 2 * objects_per_slab + 1);
+}
+
+TEST(kstd_platform_SlabAllocator, test_invalid_configuration) {
+    using namespace kstd::platform;
+
+    ASSERT_THROW(mm::SlabAllocator(64, 3), std::runtime_error);
+    ASSERT_THROW(mm::SlabAllocator(64, 16, mm::SlabFlags::NONE, 1U << 20U, 1000), std::runtime_error);
+    ASSERT_THROW(mm::SlabAllocator(1U << 20U), std::runtime_error);
+}
@@ -0,0 +1,101 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <kstd/platform/virtual_arena.hpp>
+
+TEST(kstd_platform_VirtualArena, test_allocate) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+    mm::VirtualArena arena {page_size * 64, page_size * 4};
+    ASSERT_EQ(arena.get_type(), mm::MappingType::ARENA);
+    ASSERT_EQ(arena.get_committed_size(), 0);
+
+    auto first = arena.allocate(100);
+    ASSERT_TRUE(first);
+    ASSERT_EQ(arena.get_committed_size(), page_size * 4);
+    std::memset(*first, 0xAA, 100);
+
+    auto values = arena.allocate_array<kstd::u64>(page_size);// Spans several commit steps
+    ASSERT_TRUE(values);
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(*values) % alignof(kstd::u64), 0);// NOLINT
+    (*values)[page_size - 1] = 42;
+    ASSERT_GE(arena.get_committed_size(), arena.get_marker());
+
+    ASSERT_FALSE(arena.allocate(page_size * 64));
+    ASSERT_FALSE(arena.allocate(1, 3));
+}
+
+TEST(kstd_platform_VirtualArena, test_reset_and_decommit) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+    mm::VirtualArena arena {page_size * 64, page_size};
+
+    auto first = arena.allocate(page_size);
+    ASSERT_TRUE(first);
+    const auto marker = arena.get_marker();
+
+    auto second = arena.allocate(page_size * 8);
+    ASSERT_TRUE(second);
+    std::memset(*second, 0xBB, page_size * 8);
+    ASSERT_EQ(arena.get_committed_size(), page_size * 9);
+
+    arena.reset(marker);
+    ASSERT_EQ(arena.get_marker(), marker);
+    ASSERT_TRUE(arena.decommit(mm::DecommitMode::LAZY));
+    ASSERT_EQ(arena.get_committed_size(), page_size * 9);
+    ASSERT_TRUE(arena.decommit());
+    ASSERT_EQ(arena.get_committed_size(), page_size);
+
+    auto third = arena.allocate(page_size);
+    ASSERT_TRUE(third);
+    ASSERT_EQ(*third, *second);// Pointers are stable, the same address is handed out again
+    static_cast<kstd::u8*>(*third)[0] = 0xCC;
+
+    arena.reset();
+    ASSERT_EQ(arena.get_marker(), 0);
+}
+
+TEST(kstd_platform_VirtualArena, test_lock) {
+    using namespace kstd::platform;
+
+    const auto page_size = get_page_size();
+    const auto limit = mm::get_lock_limit();
+    ASSERT_TRUE(limit);
+
+    if(*limit < page_size * 4) {
+        GTEST_SKIP() << "Lock limit is too small";
+    }
+
+    mm::VirtualArena arena {page_size * 4, page_size * 4};
+    auto* data = static_cast<kstd::u8*>(*arena.allocate(page_size * 4));
+    ASSERT_TRUE(arena.lock({0, page_size * 4}, mm::LockFlags::ON_FAULT));
+#ifdef PLATFORM_LINUX
+    ASSERT_EQ(arena.get_residency()->get_resident_page_count(), 0);// Nothing is populated before it is touched
+#endif
+
+    data[page_size] = 0xAA;
+    ASSERT_TRUE(arena.get_residency()->is_resident(1));
+    ASSERT_TRUE(arena.unlock({0, page_size * 4}));
+
+    ASSERT_FALSE(arena.lock({page_size * 4, 1}));
+}